@@ -1,8 +1,8 @@
 
 #include "epd.h"
+#include "epd_gbk.h"
 
 namespace EPD {
-    const byte Display::FRAME_END[4]                    = {0xCC, 0x33, 0xC3, 0x3C};
     const byte Display::HANDSHAKE_PACKET[9]             = {0xA5, 0x00, 0x09, Command::HANDSHAKE,            0xCC, 0x33, 0xC3, 0x3C, 0xAC};
     const byte Display::GET_BAUD_RATE_PACKET[9]         = {0xA5, 0x00, 0x09, Command::GET_BAUD_RATE,        0xCC, 0x33, 0xC3, 0x3C, 0xAE};
     const byte Display::GET_STORAGE_AREA_PACKET[9]      = {0xA5, 0x00, 0x09, Command::GET_STORAGE_AREA,     0xCC, 0x33, 0xC3, 0x3C, 0xAA};
@@ -23,6 +23,14 @@ namespace EPD {
         pinMode(wakeUpPin, OUTPUT);
         this->resetPin = resetPin;
         pinMode(resetPin, OUTPUT);
+        traceOutput = NULL;
+        refreshWindowMs = DEFAULT_REFRESH_WINDOW_MS;
+        minRefreshIntervalMs = 0;
+        refreshPending = false;
+        refreshDueAt = 0;
+        hasRefreshed = false;
+        lastRefreshAt = 0;
+        savedRefreshCount = 0;
     }
     
     
@@ -61,7 +69,7 @@ namespace EPD {
     bool Display::setBaudRate(long baudRate) {
         flushInputStream();
         
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0D;	
@@ -74,8 +82,8 @@ namespace EPD {
         outputBuffer[7] = baudRate & 0xFF;
         
         
-        memcpy(outputBuffer + 8, FRAME_END, 4);	
-        outputBuffer[12] = calculateParityByte(outputBuffer, 12);
+        memcpy(outputBuffer + 8, Protocol::FRAME_END, 4);	
+        outputBuffer[12] = Protocol::calculateParityByte(outputBuffer, 12);
         
         sendData(outputBuffer, 13);	
         
@@ -83,6 +91,9 @@ namespace EPD {
         serial.begin(baudRate);
         serial.setTimeout(100);
         
+        if (traceOutput)
+            writeTraceRecord(Trace::BAUD_RATE, outputBuffer + 4, 4);
+        
         return handshake();
     }
     
@@ -90,7 +101,7 @@ namespace EPD {
         flushInputStream();
         sendData(GET_BAUD_RATE_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
-        int size = serial.readBytes(inBuffer, 20);
+        int size = readResponse(20);
         inBuffer[size] = 0x00;
         return atol((char *)inBuffer);
     }
@@ -100,7 +111,7 @@ namespace EPD {
         sendData(GET_STORAGE_AREA_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 4);
+        readResponse(4);
         if (inBuffer[0] == '1')
             return StorageArea::MICRO_SD;
         
@@ -112,7 +123,7 @@ namespace EPD {
     bool Display::setStorageArea(StorageArea storageArea) {
         flushInputStream();
         
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0A;
@@ -121,9 +132,9 @@ namespace EPD {
         
         outputBuffer[4] = storageArea;
         
-        memcpy(outputBuffer + 5, FRAME_END, 4);
+        memcpy(outputBuffer + 5, Protocol::FRAME_END, 4);
 
-        outputBuffer[9] = calculateParityByte(outputBuffer, 9);
+        outputBuffer[9] = Protocol::calculateParityByte(outputBuffer, 9);
         
         sendData(outputBuffer, 10);
         
@@ -135,6 +146,13 @@ namespace EPD {
     }
     
     bool Display::refresh() {
+        if (refreshPending) {
+            refreshPending = false;
+            ++savedRefreshCount;
+        }
+        hasRefreshed = true;
+        lastRefreshAt = millis();
+        
         flushInputStream();
         sendData(REFRESH_PACKET, 9);
         return checkOkResponse();
@@ -146,7 +164,7 @@ namespace EPD {
         sendData(GET_DISP_DIRECTION_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 1);
+        readResponse(1);
         if (inBuffer[0] == '1')
             return DisplayDirection::INVERTED;
 
@@ -156,7 +174,7 @@ namespace EPD {
 
     bool Display::setDisplayDirection(DisplayDirection displayDirection) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0A;	
@@ -165,9 +183,9 @@ namespace EPD {
         
         outputBuffer[4] = displayDirection;
         
-        memcpy(outputBuffer + 5, FRAME_END, 4);
+        memcpy(outputBuffer + 5, Protocol::FRAME_END, 4);
         
-        outputBuffer[9] = calculateParityByte(outputBuffer, 9);
+        outputBuffer[9] = Protocol::calculateParityByte(outputBuffer, 9);
         
         sendData(outputBuffer, 10);
         
@@ -191,7 +209,7 @@ namespace EPD {
     
     bool Display::setDrawingColor(Color color, Color backgroundColor) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0B;
@@ -201,8 +219,8 @@ namespace EPD {
         outputBuffer[4] = color;
         outputBuffer[5] = backgroundColor;
         
-        memcpy(outputBuffer + 6, FRAME_END, 4);
-        outputBuffer[10] = calculateParityByte(outputBuffer, 10);
+        memcpy(outputBuffer + 6, Protocol::FRAME_END, 4);
+        outputBuffer[10] = Protocol::calculateParityByte(outputBuffer, 10);
         
         sendData(outputBuffer, 11);
         
@@ -215,7 +233,7 @@ namespace EPD {
         sendData(GET_DRAWING_COLOR_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 2);
+        readResponse(2);
 
         return charToColor(inBuffer[0]);
     }
@@ -226,7 +244,7 @@ namespace EPD {
         sendData(GET_DRAWING_COLOR_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 2);
+        readResponse(2);
 
         return charToColor(inBuffer[1]);
     }
@@ -237,7 +255,7 @@ namespace EPD {
         sendData(GET_ENGLISH_FONT_SIZE_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 1);
+        readResponse(1);
 
         return charToFontSize(inBuffer[0]);
     }
@@ -248,14 +266,14 @@ namespace EPD {
         sendData(GET_CHINESE_FONT_SIZE_PACKET, 9);
         delay(WAIT_FOR_RESPONSE_MS);
         
-        serial.readBytes(inBuffer, 1);
+        readResponse(1);
 
         return charToFontSize(inBuffer[0]);
     }
     
     bool Display::setEnglishFontSize(FontSize fontSize) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0A;	
@@ -265,8 +283,8 @@ namespace EPD {
         outputBuffer[4] = fontSize;
         
         
-        memcpy(outputBuffer + 5, FRAME_END, 4);	
-        outputBuffer[9] = calculateParityByte(outputBuffer, 9);
+        memcpy(outputBuffer + 5, Protocol::FRAME_END, 4);	
+        outputBuffer[9] = Protocol::calculateParityByte(outputBuffer, 9);
         
         sendData(outputBuffer, 10);
         return checkOkResponse();
@@ -274,7 +292,7 @@ namespace EPD {
     
     bool Display::setChineseFontSize(FontSize fontSize) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0A;	
@@ -284,8 +302,8 @@ namespace EPD {
         outputBuffer[4] = fontSize;
         
         
-        memcpy(outputBuffer + 5, FRAME_END, 4);	
-        outputBuffer[9] = calculateParityByte(outputBuffer, 9);
+        memcpy(outputBuffer + 5, Protocol::FRAME_END, 4);	
+        outputBuffer[9] = Protocol::calculateParityByte(outputBuffer, 9);
         
         sendData(outputBuffer, 10);
         return checkOkResponse();
@@ -297,7 +315,7 @@ namespace EPD {
     
     bool Display::drawPoint(unsigned int x, unsigned int y) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0D;
@@ -309,9 +327,9 @@ namespace EPD {
         outputBuffer[6] = (y >> 8) & 0xFF;
         outputBuffer[7] = y & 0xFF;
         
-        memcpy(outputBuffer + 8, FRAME_END, 4);
+        memcpy(outputBuffer + 8, Protocol::FRAME_END, 4);
 
-        outputBuffer[12] = calculateParityByte(outputBuffer, 12);
+        outputBuffer[12] = Protocol::calculateParityByte(outputBuffer, 12);
         
         sendData(outputBuffer, 13);
         
@@ -320,7 +338,7 @@ namespace EPD {
     
     bool Display::drawLine(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x11;	
@@ -336,9 +354,9 @@ namespace EPD {
         outputBuffer[10] = (y1 >> 8) & 0xFF;
         outputBuffer[11] = y1 & 0xFF;	
         
-        memcpy(outputBuffer + 12, FRAME_END, 4);
+        memcpy(outputBuffer + 12, Protocol::FRAME_END, 4);
 
-        outputBuffer[16] = calculateParityByte(outputBuffer, 16);
+        outputBuffer[16] = Protocol::calculateParityByte(outputBuffer, 16);
         
         sendData(outputBuffer, 17);
         
@@ -347,7 +365,7 @@ namespace EPD {
     
     bool Display::fillRectangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x11;	
@@ -364,8 +382,8 @@ namespace EPD {
         outputBuffer[11] = y1 & 0xFF;	
         
         
-        memcpy(outputBuffer + 12, FRAME_END, 4);	
-        outputBuffer[16] = calculateParityByte(outputBuffer, 16);
+        memcpy(outputBuffer + 12, Protocol::FRAME_END, 4);	
+        outputBuffer[16] = Protocol::calculateParityByte(outputBuffer, 16);
         
         sendData(outputBuffer, 17);
         return checkOkResponse();
@@ -373,7 +391,7 @@ namespace EPD {
     
     bool Display::drawRectangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x11;	
@@ -390,8 +408,8 @@ namespace EPD {
         outputBuffer[11] = y1 & 0xFF;	
         
         
-        memcpy(outputBuffer + 12, FRAME_END, 4);	
-        outputBuffer[16] = calculateParityByte(outputBuffer, 16);
+        memcpy(outputBuffer + 12, Protocol::FRAME_END, 4);	
+        outputBuffer[16] = Protocol::calculateParityByte(outputBuffer, 16);
         
         sendData(outputBuffer, 17);
         return checkOkResponse();
@@ -399,7 +417,7 @@ namespace EPD {
     
     bool Display::drawCircle(unsigned int x, unsigned int y, unsigned int radius) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0F;	
@@ -414,8 +432,8 @@ namespace EPD {
         outputBuffer[9] = radius & 0xFF;
         
         
-        memcpy(outputBuffer + 10, FRAME_END, 4);	
-        outputBuffer[14] = calculateParityByte(outputBuffer, 14);
+        memcpy(outputBuffer + 10, Protocol::FRAME_END, 4);	
+        outputBuffer[14] = Protocol::calculateParityByte(outputBuffer, 14);
         
         sendData(outputBuffer, 15);
         return checkOkResponse();
@@ -423,7 +441,7 @@ namespace EPD {
     
     bool Display::fillCircle(unsigned int x, unsigned int y, unsigned int radius) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x0F;	
@@ -438,8 +456,8 @@ namespace EPD {
         outputBuffer[9] = radius & 0xFF;
         
         
-        memcpy(outputBuffer + 10, FRAME_END, 4);	
-        outputBuffer[14] = calculateParityByte(outputBuffer, 14);
+        memcpy(outputBuffer + 10, Protocol::FRAME_END, 4);	
+        outputBuffer[14] = Protocol::calculateParityByte(outputBuffer, 14);
         
         sendData(outputBuffer, 15);
         return checkOkResponse();
@@ -447,7 +465,7 @@ namespace EPD {
     
     bool Display::drawTriangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x15;	
@@ -468,8 +486,8 @@ namespace EPD {
         outputBuffer[15] = y2 & 0xFF;	
         
         
-        memcpy(outputBuffer + 16, FRAME_END, 4);	
-        outputBuffer[20] = calculateParityByte(outputBuffer, 20);
+        memcpy(outputBuffer + 16, Protocol::FRAME_END, 4);	
+        outputBuffer[20] = Protocol::calculateParityByte(outputBuffer, 20);
         
         sendData(outputBuffer, 21);
         return checkOkResponse();
@@ -477,7 +495,7 @@ namespace EPD {
     
     bool Display::fillTriangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, unsigned int x2, unsigned int y2) {
         flushInputStream();
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
 	
         outputBuffer[1] = 0x00;
         outputBuffer[2] = 0x15;	
@@ -498,8 +516,8 @@ namespace EPD {
         outputBuffer[15] = y2 & 0xFF;	
         
         
-        memcpy(outputBuffer + 16, FRAME_END, 4);	
-        outputBuffer[20] = calculateParityByte(outputBuffer, 20);
+        memcpy(outputBuffer + 16, Protocol::FRAME_END, 4);	
+        outputBuffer[20] = Protocol::calculateParityByte(outputBuffer, 20);
         
         sendData(outputBuffer, 21);
         return checkOkResponse();
@@ -523,7 +541,7 @@ namespace EPD {
         stringSize = strlen(ptr) + 1; //Add one for the null character
         int packetSize = stringSize + 13;
         
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
         
         outputBuffer[1] = (packetSize >> 8) & 0xFF;
         outputBuffer[2] = packetSize & 0xFF;
@@ -537,8 +555,33 @@ namespace EPD {
         
         strcpy((char *)(outputBuffer + 8), ptr);
                 
-        memcpy(outputBuffer + (packetSize - 5), FRAME_END, 4);
-        outputBuffer[packetSize - 1] = calculateParityByte(outputBuffer, packetSize - 1);
+        memcpy(outputBuffer + (packetSize - 5), Protocol::FRAME_END, 4);
+        outputBuffer[packetSize - 1] = Protocol::calculateParityByte(outputBuffer, packetSize - 1);
+        
+        sendData(outputBuffer, packetSize);
+        
+        return checkOkResponse();
+    }
+    
+    bool Display::displayUtf8Text(unsigned int x, unsigned int y, const char *str) {
+        //transcode straight into the frame, leaving room for the frame end and parity byte
+        int stringSize = Gbk::fromUtf8((char *)(outputBuffer + 8), sizeof(outputBuffer) - 13, str) + 1;
+        int packetSize = stringSize + 13;
+        
+        outputBuffer[0] = Protocol::FRAME_HEADER;
+        
+        outputBuffer[1] = (packetSize >> 8) & 0xFF;
+        outputBuffer[2] = packetSize & 0xFF;
+        
+        outputBuffer[3] = Command::DISPLAY_TEXT;
+        
+        outputBuffer[4] = (x >> 8) & 0xFF;
+        outputBuffer[5] = x & 0xFF;
+        outputBuffer[6] = (y >> 8) & 0xFF;
+        outputBuffer[7] = y & 0xFF;
+                
+        memcpy(outputBuffer + (packetSize - 5), Protocol::FRAME_END, 4);
+        outputBuffer[packetSize - 1] = Protocol::calculateParityByte(outputBuffer, packetSize - 1);
         
         sendData(outputBuffer, packetSize);
         
@@ -552,7 +595,7 @@ namespace EPD {
         stringSize = strlen(ptr) + 1; //Add one for the null character
         int packetSize = stringSize + 13;
         
-        outputBuffer[0] = FRAME_HEADER;
+        outputBuffer[0] = Protocol::FRAME_HEADER;
         
         outputBuffer[1] = (packetSize >> 8) & 0xFF;
         outputBuffer[2] = packetSize & 0xFF;
@@ -566,8 +609,8 @@ namespace EPD {
         
         strcpy((char *)(outputBuffer + 8), ptr);
                 
-        memcpy(outputBuffer + (packetSize - 5), FRAME_END, 4);
-        outputBuffer[packetSize - 1] = calculateParityByte(outputBuffer, packetSize - 1);
+        memcpy(outputBuffer + (packetSize - 5), Protocol::FRAME_END, 4);
+        outputBuffer[packetSize - 1] = Protocol::calculateParityByte(outputBuffer, packetSize - 1);
         
         sendData(outputBuffer, packetSize);
         
@@ -575,17 +618,70 @@ namespace EPD {
     }
     
 
-    /* Private functions */
     
-    byte Display::calculateParityByte(const byte *data, int length) {
-        byte parityByte = 0x00;
-        for (int i = 0; i<length; ++i) {
-            parityByte ^= data[i];
+    /* Refresh Scheduling Functions */
+    
+    void Display::setRefreshWindow(unsigned long windowMs) {
+        refreshWindowMs = windowMs;
+    }
+    
+    void Display::setMinRefreshInterval(unsigned long intervalMs) {
+        minRefreshIntervalMs = intervalMs;
+    }
+    
+    bool Display::requestRefresh(bool priority) {
+        unsigned long now = millis();
+        
+        if (refreshPending) {
+            ++savedRefreshCount;
+            if (priority)
+                refreshDueAt = now;
+        } else {
+            refreshPending = true;
+            refreshDueAt = priority ? now : now + refreshWindowMs;
         }
-        return parityByte;
+        
+        return serviceRefresh();
+    }
+    
+    //Returns false only if a refresh was sent and failed
+    bool Display::serviceRefresh() {
+        if (!refreshPending)
+            return true;
+        
+        unsigned long now = millis();
+        if ((long)(now - refreshDueAt) < 0)
+            return true;
+        if (hasRefreshed && now - lastRefreshAt < minRefreshIntervalMs)
+            return true;
+        
+        refreshPending = false;
+        return refresh();
+    }
+    
+    bool Display::isRefreshPending() {
+        return refreshPending;
+    }
+    
+    unsigned long Display::getSavedRefreshCount() {
+        return savedRefreshCount;
+    }
+    
+    
+    /* Debugging Functions */
+    
+    //Pass NULL to stop tracing. Tracing adds the time it takes to write each record to every command.
+    void Display::setTraceOutput(Print *traceOutput) {
+        this->traceOutput = traceOutput;
     }
     
+
+    /* Private functions */
+    
     void Display::sendData(const byte *data, int length) {
+        if (traceOutput)
+            writeTraceRecord(Trace::TX, data, length);
+        
         for(int i = 0; i < length; i++)
         {
             serial.write(data[i]);
@@ -599,9 +695,34 @@ namespace EPD {
     }
     
     
+    int Display::readResponse(int length) {
+        int size = serial.readBytes(inBuffer, length);
+        if (traceOutput)
+            writeTraceRecord(Trace::RX, inBuffer, size);
+        return size;
+    }
+    
+    void Display::writeTraceRecord(byte kind, const byte *data, int length) {
+        unsigned long timestamp = micros();
+        byte header[Trace::RECORD_HEADER_LENGTH];
+        
+        header[0] = kind;
+        
+        header[1] = (timestamp >> 24) & 0xFF;
+        header[2] = (timestamp >> 16) & 0xFF;
+        header[3] = (timestamp >> 8) & 0xFF;
+        header[4] = timestamp & 0xFF;
+        
+        header[5] = (length >> 8) & 0xFF;
+        header[6] = length & 0xFF;
+        
+        traceOutput->write(header, Trace::RECORD_HEADER_LENGTH);
+        traceOutput->write(data, length);
+    }
+    
     bool Display::checkOkResponse() {
         delay(WAIT_FOR_RESPONSE_MS); //give the display a short ammount of time to process and respond
-        int size = serial.readBytes(inBuffer, 2);
+        int size = readResponse(2);
         if (inBuffer[0] == 'O' && inBuffer[1] == 'K')
             return true;
         
@@ -12,68 +12,19 @@
 #define EPD_h
 
 #include "Arduino.h"
+#include "epd_protocol.h"
 
 namespace EPD {
 
-    enum Color : byte {
-        BLACK       = 0x00,
-        DARK_GREY   = 0x01,
-        LIGHT_GREY  = 0x02,
-        WHITE       = 0x03
-    };
-    
-    enum StorageArea : byte {
-        NAND_FLASH  = 0x00,
-        MICRO_SD    = 0x01
-    };
-    
-    enum DisplayDirection : byte {
-        NORMAL      = 0x00,
-        INVERTED    = 0x01
-    };
-    
-    enum FontSize : byte {
-        DOTS_MATRIX_32  = 0x01,
-        DOTS_MATRIX_48  = 0x02,
-        DOTS_MATRIX_64  = 0x03
-    };
-    
-    enum Command : byte {
-        /* System Control Commands */
-        HANDSHAKE               = 0x00,
-        SET_BAUD_RATE           = 0x01,
-        GET_BAUD_RATE           = 0x02,
-        GET_STORAGE_AREA        = 0x06,
-        SET_STORAGE_AREA        = 0x07,
-        ENTER_SLEEP             = 0x08,
-        REFRESH                 = 0x0A,
-        GET_DISP_DIRECTION      = 0x0C,
-        SET_DISP_DIRECTION      = 0x0D,
-        IMPORT_FONT_LIBRARY     = 0x0E,
-        IMPORT_IMAGE            = 0x0F,
-        
-        /* Display Parameter Configuration Commands */
-        SET_DRAWING_COLOR       = 0x10,
-        GET_DRAWING_COLOR       = 0x11,
-        GET_ENGLISH_FONT_SIZE   = 0x1C,
-        GET_CHINESE_FONT_SIZE   = 0x1D,
-        SET_ENGLISH_FONT_SIZE   = 0x1E,
-        SET_CHINESE_FONT_SIZE   = 0x1F,
-        
-        /* Basic Drawing Commands */
-        DRAW_POINT              = 0x20,
-        DRAW_LINE               = 0x22,
-        FILL_RECTANGLE          = 0x24,
-        DRAW_RECTANGLE          = 0x25,
-        DRAW_CIRCLE             = 0x26,
-        FILL_CIRCLE             = 0x27,
-        DRAW_TRIANGLE           = 0x28,
-        FILL_TRIANGLE           = 0x29,
-        CLEAR_SCREEN            = 0x2E,
-        DISPLAY_TEXT            = 0x30,
-        DISPLAY_IMAGE           = 0x70
-    };
-
+    /**
+     *  Refresh Scheduling:
+     *      Every REFRESH redraws the whole panel and takes several seconds, so code that draws from several places
+     *      can call requestRefresh() instead of refresh(). Requests that arrive within the refresh window of the
+     *      first one are merged into a single refresh, and refreshes are never sent closer together than the
+     *      minimum refresh interval. Priority requests skip the window but still respect the interval. Pending
+     *      refreshes are only sent from requestRefresh() and serviceRefresh(), so call serviceRefresh() from
+     *      loop(). Calling refresh() directly sends it immediately and satisfies any pending request.
+     */
     class Display {
         
         public:
@@ -117,14 +68,25 @@ namespace EPD {
             bool clearScreen();
             
             bool displayText(unsigned int x, unsigned int y, const void *str);
+            bool displayUtf8Text(unsigned int x, unsigned int y, const char *str);
             
             bool displayImage(unsigned int x, unsigned int y, const void *fileName);
             
+            /* Refresh Scheduling Functions */
+            void setRefreshWindow(unsigned long windowMs);
+            void setMinRefreshInterval(unsigned long intervalMs);
+            bool requestRefresh(bool priority = false);
+            bool serviceRefresh();
+            bool isRefreshPending();
+            unsigned long getSavedRefreshCount();
+            
+            /* Debugging Functions */
+            void setTraceOutput(Print *traceOutput);
+            
             
         private:
             static const short WAIT_FOR_RESPONSE_MS = 20;
-            static const byte FRAME_HEADER = 0xA5;
-            static const byte FRAME_END[4];
+            static const short DEFAULT_REFRESH_WINDOW_MS = 500;
             
             /* System Control Command Packets */
             static const byte HANDSHAKE_PACKET[9];
@@ -145,9 +107,18 @@ namespace EPD {
             int resetPin;
             byte outputBuffer[1033];
             byte inBuffer[256];
-            byte calculateParityByte(const byte *data, int length);
+            Print *traceOutput;
+            unsigned long refreshWindowMs;
+            unsigned long minRefreshIntervalMs;
+            bool refreshPending;
+            unsigned long refreshDueAt;
+            bool hasRefreshed;
+            unsigned long lastRefreshAt;
+            unsigned long savedRefreshCount;
             void sendData(const byte *data, int length);
             void flushInputStream();
+            int readResponse(int length);
+            void writeTraceRecord(byte kind, const byte *data, int length);
             bool checkOkResponse();
             Color charToColor(char inByte);
             FontSize charToFontSize(char inByte);
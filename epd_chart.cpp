@@ -0,0 +1,172 @@
+#include "epd_chart.h"
+
+namespace EPD {
+
+    Chart::Chart(Display &display, Style style, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+            int minValue, int maxValue, unsigned long sampleCount, byte barWidth):display(display) {
+        this->style = style;
+        this->x0 = x0;
+        this->y0 = y0;
+        this->x1 = x1;
+        this->y1 = y1;
+        this->minValue = minValue;
+        this->maxValue = maxValue;
+        this->sampleCount = sampleCount;
+        columnWidth = (style == Style::BAR && barWidth > 1) ? barWidth : 1;
+        columnCount = max((x1 - x0 + 1) / columnWidth, 1U);
+        reset();
+    }
+
+    bool Chart::plot(const int *samples, unsigned long count) {
+        bool success = true;
+        reset();
+        for (unsigned long i = 0; i < count; ++i) {
+            success &= append(samples[i]);
+        }
+        success &= flush();
+        return success;
+    }
+
+    bool Chart::append(int sample) {
+        if (samplesSeen >= sampleCount)
+            return false; //the chart is full
+
+        unsigned int sampleColumn = samplesSeen * columnCount / sampleCount;
+        unsigned int y = valueToY(sample);
+        ++samplesSeen;
+
+        bool success = true;
+        if (hasColumn && sampleColumn == column) {
+            columnTop = min(columnTop, y);
+            columnBottom = max(columnBottom, y);
+            columnLast = y;
+            columnDirty = true;
+            return success;
+        }
+
+        if (hasColumn)
+            success &= finishColumn();
+
+        hasColumn = true;
+        columnDirty = true;
+        gapFilled = false;
+        column = sampleColumn;
+        columnTop = y;
+        columnBottom = y;
+        columnFirst = y;
+        columnLast = y;
+
+        return success;
+    }
+
+    bool Chart::flush() {
+        bool success = true;
+        if (style == Style::AREA && hasColumn && columnDirty)
+            success &= fillGap();
+        success &= flushRun();
+        if (hasColumn && columnDirty) {
+            success &= drawColumn();
+            columnDirty = false;
+        }
+        return success;
+    }
+
+    void Chart::reset() {
+        samplesSeen = 0;
+        hasColumn = false;
+        gapFilled = false;
+        hasPrevious = false;
+        hasRun = false;
+    }
+
+
+    /* Private functions */
+
+    unsigned int Chart::valueToY(int value) {
+        if (maxValue <= minValue || value <= minValue)
+            return y1;
+        if (value >= maxValue)
+            return y0;
+        return y1 - ((long)value - minValue) * (y1 - y0) / ((long)maxValue - minValue);
+    }
+
+    bool Chart::drawColumn() {
+        unsigned int x = x0 + column * columnWidth;
+
+        if (style == Style::BAR) {
+            //leave a one pixel gap between bars, unless they're only one pixel wide, and stay inside the chart
+            unsigned int right = columnWidth > 1 ? x + columnWidth - 2 : x;
+            return display.fillRectangle(x, columnTop, min(right, x1), y1);
+        }
+
+        if (style == Style::AREA)
+            return display.drawLine(x, columnTop, x, y1);
+
+        if (hasPrevious && column > previousColumn + 1) {
+            //fewer samples than columns, so join the points up with a sloped line
+            bool success = display.drawLine(x0 + previousColumn, previousLast, x, columnFirst);
+            if (columnTop != columnBottom)
+                success &= display.drawLine(x, columnTop, x, columnBottom);
+            return success;
+        }
+
+        //stretching the column to the previous column's last value is enough to join adjacent columns
+        unsigned int top = columnTop;
+        unsigned int bottom = columnBottom;
+        if (hasPrevious) {
+            top = min(top, previousLast);
+            bottom = max(bottom, previousLast);
+        }
+        return display.drawLine(x, top, x, bottom);
+    }
+
+    bool Chart::finishColumn() {
+        bool success = true;
+
+        if (style == Style::AREA && columnDirty) {
+            success &= fillGap();
+            if (hasRun && runTop == columnTop && runEnd + 1 == column) {
+                runEnd = column;
+            } else {
+                success &= flushRun();
+                hasRun = true;
+                runStart = column;
+                runEnd = column;
+                runTop = columnTop;
+            }
+        } else if (columnDirty) {
+            success &= drawColumn();
+        }
+
+        hasColumn = false;
+        columnDirty = false;
+        hasPrevious = true;
+        previousColumn = column;
+        previousLast = columnLast;
+        previousTop = columnTop;
+
+        return success;
+    }
+
+    //AREA charts hold the last height across columns that no sample landed in
+    bool Chart::fillGap() {
+        if (gapFilled || !hasPrevious || previousColumn + 1 >= column)
+            return true;
+
+        gapFilled = true;
+        if (hasRun && runEnd == previousColumn) {
+            runEnd = column - 1;
+            return true;
+        }
+        //the previous column was already sent by flush(), so the gap needs its own rectangle
+        return display.fillRectangle(x0 + previousColumn + 1, previousTop, x0 + column - 1, y1);
+    }
+
+    bool Chart::flushRun() {
+        if (!hasRun)
+            return true;
+
+        hasRun = false;
+        return display.fillRectangle(x0 + runStart, runTop, x0 + runEnd, y1);
+    }
+};
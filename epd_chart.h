@@ -0,0 +1,85 @@
+/**
+ *  Chart draws line, area and bar charts of a series of samples using the panel's native DRAW_LINE and
+ *  FILL_RECTANGLE commands.
+ *
+ *  The chart spans sampleCount samples across its width, and samples are reduced to one column per pixel (or
+ *  per bar) before anything is sent by keeping the minimum, maximum, first and last value of each column. The
+ *  number of frames therefore grows with the width of the chart instead of the number of samples, while peaks
+ *  and dips are still drawn. Samples can be passed all at once with plot() or one at a time with append(), in
+ *  which case only columns that are complete are drawn until flush() is called.
+ *
+ *  Charts are drawn in the current drawing color and never blank the plot area, so clear it (or the screen)
+ *  before calling reset() and starting over.
+ */
+#ifndef EPD_CHART_h
+#define EPD_CHART_h
+
+#include "Arduino.h"
+#include "epd.h"
+
+namespace EPD {
+
+    class Chart {
+
+        public:
+            enum Style : byte {
+                LINE    = 0x00,
+                AREA    = 0x01,
+                BAR     = 0x02
+            };
+
+            Chart(Display &display, Style style, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                int minValue, int maxValue, unsigned long sampleCount, byte barWidth = 8);
+
+            bool plot(const int *samples, unsigned long count);
+            bool append(int sample);
+            bool flush();
+            void reset();
+
+
+        private:
+            Display &display;
+            Style style;
+            unsigned int x0;
+            unsigned int y0;
+            unsigned int x1;
+            unsigned int y1;
+            int minValue;
+            int maxValue;
+            unsigned long sampleCount;
+            byte columnWidth;
+            unsigned int columnCount;
+            unsigned long samplesSeen;
+
+            /* The column that samples are currently being added to, in pixels */
+            bool hasColumn;
+            bool columnDirty;
+            bool gapFilled;
+            unsigned int column;
+            unsigned int columnTop;
+            unsigned int columnBottom;
+            unsigned int columnFirst;
+            unsigned int columnLast;
+
+            /* The last completed column, so lines can be joined up */
+            bool hasPrevious;
+            unsigned int previousColumn;
+            unsigned int previousLast;
+            unsigned int previousTop;
+
+            /* Adjacent AREA columns of the same height are sent as one rectangle */
+            bool hasRun;
+            unsigned int runStart;
+            unsigned int runEnd;
+            unsigned int runTop;
+
+            unsigned int valueToY(int value);
+            bool drawColumn();
+            bool finishColumn();
+            bool fillGap();
+            bool flushRun();
+    };
+
+};
+
+#endif
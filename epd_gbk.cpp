@@ -0,0 +1,98 @@
+#include "epd_gbk.h"
+#include "epd_gbk_table.h"
+
+namespace EPD {
+    namespace Gbk {
+
+        static byte countBits(byte value) {
+            value = value - ((value >> 1) & 0x55);
+            value = (value & 0x33) + ((value >> 2) & 0x33);
+            return (value + (value >> 4)) & 0x0F;
+        }
+
+        /* Decodes one UTF-8 sequence and returns a pointer to the byte after it. Malformed sequences and code
+           points outside the Basic Multilingual Plane decode to 0xFFFF. */
+        static const char *nextCodePoint(const char *src, uint16_t &codePoint) {
+            byte leadByte = *src++;
+            byte continuationBytes;
+
+            if (leadByte < 0x80) {
+                codePoint = leadByte;
+                return src;
+            } else if ((leadByte & 0xE0) == 0xC0) {
+                codePoint = leadByte & 0x1F;
+                continuationBytes = 1;
+            } else if ((leadByte & 0xF0) == 0xE0) {
+                codePoint = leadByte & 0x0F;
+                continuationBytes = 2;
+            } else if ((leadByte & 0xF8) == 0xF0) {
+                codePoint = 0xFFFF;
+                continuationBytes = 3;
+            } else {
+                codePoint = 0xFFFF;
+                return src;
+            }
+
+            for (byte i = 0; i < continuationBytes; ++i) {
+                if (((byte)*src & 0xC0) != 0x80) {
+                    //don't consume the null character or the start of the next sequence
+                    codePoint = 0xFFFF;
+                    return src;
+                }
+                if (codePoint != 0xFFFF)
+                    codePoint = (codePoint << 6) | ((byte)*src & 0x3F);
+                ++src;
+            }
+            return src;
+        }
+
+        uint16_t fromCodePoint(uint16_t codePoint) {
+            if (codePoint < 0x80)
+                return codePoint;
+
+            byte slot = pgm_read_byte(&GBK_PAGE_INDEX[codePoint >> 8]);
+            if (slot == 0xFF)
+                return 0;
+
+            unsigned int block = slot * 4 + ((codePoint >> 6) & 0x03);
+            byte bit = codePoint & 0x3F;
+            byte bitmap = pgm_read_byte(&GBK_BLOCK_BITMAPS[block][bit >> 3]);
+            if (!(bitmap & (1 << (bit & 0x07))))
+                return 0;
+
+            //the index of the code is the number of characters in the block before this one
+            unsigned int index = pgm_read_word(&GBK_BLOCK_BASES[block]);
+            for (byte i = 0; i < (bit >> 3); ++i) {
+                index += countBits(pgm_read_byte(&GBK_BLOCK_BITMAPS[block][i]));
+            }
+            index += countBits(bitmap & ((1 << (bit & 0x07)) - 1));
+
+            return pgm_read_word(&GBK_CODES[index]);
+        }
+
+        unsigned int fromUtf8(char *dest, unsigned int size, const char *src) {
+            unsigned int length = 0;
+            while (*src != 0x00) {
+                uint16_t codePoint;
+                src = nextCodePoint(src, codePoint);
+                uint16_t code = codePoint == 0xFFFF ? 0 : fromCodePoint(codePoint);
+
+                if (code == 0)
+                    code = REPLACEMENT_CHAR;
+
+                if (code < 0x80) {
+                    if (length + 1 >= size)
+                        break;
+                    dest[length++] = code;
+                } else {
+                    if (length + 2 >= size)
+                        break;
+                    dest[length++] = (code >> 8) & 0xFF;
+                    dest[length++] = code & 0xFF;
+                }
+            }
+            dest[length] = 0x00;
+            return length;
+        }
+    };
+};
@@ -0,0 +1,27 @@
+/**
+ *  UTF-8 to GBK transcoding for displayText(). The panel's fonts are GB2312, so only characters that the fonts
+ *  can draw are mapped and everything else is replaced with REPLACEMENT_CHAR.
+ *
+ *  Lookups go through a two level table kept in flash (see epd_gbk_table.h), take constant time and never
+ *  allocate. The table can be regenerated for a smaller character set with extras/tools/generate_gbk_table.py.
+ */
+#ifndef EPD_GBK_h
+#define EPD_GBK_h
+
+#include "Arduino.h"
+
+namespace EPD {
+    namespace Gbk {
+        const char REPLACEMENT_CHAR = '?';
+
+        /* Returns the GBK code for the code point, or 0 if the panel's fonts can't draw it. ASCII maps to itself. */
+        uint16_t fromCodePoint(uint16_t codePoint);
+
+        /* Converts a null terminated UTF-8 string, writing at most size - 1 bytes plus the null character to
+           dest. Two byte characters are never cut in half. Returns the number of bytes written, not counting the
+           null character. */
+        unsigned int fromUtf8(char *dest, unsigned int size, const char *src);
+    };
+};
+
+#endif
@@ -0,0 +1,831 @@
+/**
+ *  Generated by extras/tools/generate_gbk_table.py, do not edit.
+ *  4437 characters, 96 pages, 12970 bytes of flash.
+ */
+#ifndef EPD_GBK_TABLE_h
+#define EPD_GBK_TABLE_h
+
+namespace EPD {
+    namespace Gbk {
+
+        const unsigned int BLOCK_COUNT = 384;
+        const unsigned int CODE_COUNT = 4437;
+
+        const uint8_t GBK_PAGE_INDEX[256] PROGMEM = {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0x0C, 0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x10,
+            0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+            0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+            0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40,
+            0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50,
+            0x51, 0x52, 0x53, 0xFF, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0xFF, 0x5D, 0x5E,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+        };
+
+        const uint8_t GBK_BLOCK_BITMAPS[BLOCK_COUNT][8] PROGMEM = {
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x03, 0x00},
+            {0x00, 0x00, 0x80, 0x00, 0x03, 0x37, 0x8C, 0x16},
+            {0x02, 0x00, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00},
+            {0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x40, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0xFE, 0xFF, 0xFB, 0x03, 0xFE, 0xFF},
+            {0xFB, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+            {0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x60, 0x33, 0x40, 0x00, 0x0D, 0x08},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00},
+            {0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x81, 0x02, 0x64, 0xA1, 0x4F, 0xF0, 0x20},
+            {0x00, 0x11, 0x00, 0x00, 0x33, 0xC0, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF0, 0xFF},
+            {0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+            {0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00},
+            {0xC0, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x2F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+            {0xFF, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0xFF, 0xFF},
+            {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x08},
+            {0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x8B, 0x6F, 0x5A, 0x3F, 0xB4, 0x2C, 0x15, 0x6F},
+            {0x28, 0xFB, 0x5D, 0xE3, 0x43, 0x00, 0x0B, 0x40},
+            {0x40, 0xDB, 0x36, 0x0C, 0xF6, 0x7B, 0x04, 0x84},
+            {0xE3, 0x6C, 0xFA, 0x83, 0x38, 0x14, 0xC5, 0xA8},
+            {0x02, 0xE4, 0x83, 0xC7, 0x51, 0x84, 0x51, 0x15},
+            {0x48, 0xE0, 0x2B, 0x1A, 0x09, 0x92, 0x09, 0x80},
+            {0x10, 0x29, 0x80, 0x28, 0xE9, 0xC3, 0x20, 0x80},
+            {0x18, 0x84, 0x81, 0x61, 0x02, 0xE2, 0x02, 0x04},
+            {0x00, 0x20, 0x14, 0x87, 0x42, 0x04, 0x00, 0x54},
+            {0x80, 0x80, 0x00, 0x14, 0x20, 0x00, 0xC0, 0x80},
+            {0x21, 0x21, 0x00, 0x00, 0x08, 0x11, 0x04, 0x08},
+            {0x00, 0x80, 0x00, 0x04, 0x80, 0x00, 0x28, 0x08},
+            {0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x80},
+            {0x7A, 0x2B, 0x12, 0x14, 0x24, 0x39, 0xFB, 0x3B},
+            {0x21, 0x33, 0xA4, 0x1A, 0x11, 0x90, 0xED, 0x08},
+            {0x51, 0x9A, 0x02, 0x28, 0x13, 0xA0, 0x49, 0xAF},
+            {0xCB, 0x04, 0x86, 0x2F, 0x11, 0x4B, 0xC1, 0x2F},
+            {0x0E, 0x24, 0x53, 0x00, 0xA0, 0x86, 0x04, 0x80},
+            {0x00, 0x01, 0x00, 0xE8, 0x0B, 0x0F, 0x0E, 0x80},
+            {0x88, 0x0A, 0x04, 0x81, 0x10, 0x00, 0x00, 0xC4},
+            {0x61, 0x01, 0xC0, 0x22, 0x0B, 0x04, 0x00, 0x8E},
+            {0x8A, 0xC7, 0xEE, 0x54, 0x97, 0x88, 0xBB, 0x81},
+            {0x74, 0x1A, 0x20, 0x85, 0x44, 0x03, 0x00, 0x88},
+            {0x06, 0x3F, 0xD2, 0x0B, 0x79, 0xFC, 0xCD, 0x13},
+            {0x1A, 0xF7, 0xAB, 0xE8, 0xC1, 0xFB, 0x32, 0x5B},
+            {0x41, 0x05, 0x21, 0x19, 0x04, 0x01, 0x28, 0x39},
+            {0x41, 0xD8, 0x65, 0x02, 0x00, 0x91, 0x0A, 0x21},
+            {0xD3, 0x63, 0x82, 0x80, 0x60, 0x67, 0x04, 0x14},
+            {0xC2, 0x02, 0x01, 0x00, 0x10, 0xD0, 0x02, 0x40},
+            {0x58, 0x04, 0x00, 0x00, 0x72, 0x44, 0x00, 0x11},
+            {0x95, 0x06, 0x00, 0x31, 0x80, 0x00, 0x88, 0x08},
+            {0x20, 0x00, 0x08, 0x10, 0x0A, 0x00, 0x00, 0x20},
+            {0x00, 0x42, 0x00, 0x09, 0x00, 0x00, 0x56, 0x88},
+            {0x00, 0x40, 0x00, 0x00, 0x00, 0x15, 0x40, 0x00},
+            {0x00, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x80, 0x10},
+            {0x00, 0x04, 0x00, 0x4C, 0x15, 0x20, 0x13, 0x64},
+            {0x48, 0x01, 0x00, 0x80, 0x08, 0x21, 0x01, 0x44},
+            {0x81, 0xE4, 0x83, 0xEC, 0x53, 0x84, 0x80, 0x00},
+            {0x1C, 0x08, 0x04, 0x08, 0x4C, 0x48, 0x00, 0x00},
+            {0x0C, 0x48, 0x10, 0x80, 0x01, 0x00, 0x00, 0x06},
+            {0x44, 0x00, 0x22, 0x00, 0x12, 0x04, 0x21, 0x00},
+            {0x00, 0x10, 0x12, 0x41, 0x00, 0x08, 0x00, 0x00},
+            {0x28, 0x00, 0x0C, 0xC2, 0x00, 0x03, 0x00, 0x00},
+            {0x02, 0x00, 0x20, 0x00, 0x10, 0x58, 0x49, 0x02},
+            {0x90, 0xA0, 0x60, 0x94, 0x80, 0xCE, 0x92, 0x07},
+            {0x90, 0xCB, 0xD2, 0x00, 0x25, 0x00, 0x58, 0x23},
+            {0xD4, 0x05, 0x4C, 0x02, 0x20, 0x41, 0x00, 0x0A},
+            {0x40, 0x08, 0x1B, 0x14, 0x20, 0x11, 0x00, 0x88},
+            {0x9A, 0x00, 0x00, 0x91, 0x21, 0x02, 0x42, 0x00},
+            {0x40, 0x02, 0x00, 0x04, 0x00, 0x04, 0x50, 0x80},
+            {0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x08, 0x00},
+            {0x06, 0x12, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0xB1, 0xB3, 0x58, 0x06, 0x21, 0x24},
+            {0xAA, 0x9B, 0x80, 0x7F, 0x5F, 0x0C, 0x79, 0xE2},
+            {0xF4, 0x10, 0x0D, 0xE0, 0x22, 0x01, 0x00, 0x9F},
+            {0x52, 0x86, 0x52, 0x25, 0x90, 0x00, 0x02, 0xF7},
+            {0x27, 0xCF, 0x22, 0x40, 0x23, 0x80, 0x02, 0x82},
+            {0x06, 0x00, 0x90, 0x08, 0x00, 0x22, 0x08, 0x81},
+            {0x00, 0x00, 0x00, 0x02, 0x42, 0x25, 0x01, 0x08},
+            {0x80, 0x40, 0x50, 0x00, 0x00, 0x22, 0x00, 0x00},
+            {0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x20, 0x00, 0x60, 0xE6, 0x4B, 0x9E, 0x40},
+            {0x6E, 0x11, 0x61, 0x3D, 0xC0, 0x60, 0x00, 0x21},
+            {0x24, 0x10, 0x20, 0x00, 0x04, 0x00, 0x5C, 0xB9},
+            {0xD0, 0x84, 0xB9, 0xD6, 0xC0, 0x20, 0xC0, 0x01},
+            {0x00, 0x06, 0x48, 0x00, 0x00, 0x00, 0xC0, 0x04},
+            {0x1D, 0x84, 0xA8, 0x89, 0xE1, 0x80, 0x02, 0x06},
+            {0x00, 0x00, 0x2C, 0x20, 0x54, 0x36, 0x03, 0x1A},
+            {0x33, 0x0D, 0x85, 0x01, 0x02, 0x44, 0x80, 0x20},
+            {0x68, 0x30, 0x80, 0x03, 0x81, 0x08, 0x22, 0xA8},
+            {0x07, 0x40, 0x74, 0x30, 0xA1, 0x85, 0x00, 0x08},
+            {0x08, 0x28, 0x25, 0x00, 0x14, 0xBB, 0x49, 0x90},
+            {0x10, 0x22, 0x10, 0x80, 0x49, 0x91, 0x04, 0x11},
+            {0x20, 0x0C, 0x22, 0x90, 0xC1, 0xEB, 0x49, 0x06},
+            {0x02, 0x83, 0x00, 0x84, 0x90, 0x00, 0x00, 0x80},
+            {0x00, 0x51, 0x22, 0x00, 0x84, 0x01, 0x81, 0x00},
+            {0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x40},
+            {0x04, 0x05, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00},
+            {0x00, 0xF5, 0x47, 0x05, 0x00, 0x44, 0x98, 0x80},
+            {0x83, 0x68, 0x1E, 0x09, 0xC8, 0xFA, 0x49, 0xD2},
+            {0x11, 0x06, 0xEE, 0x0D, 0x37, 0x19, 0x22, 0xB2},
+            {0xF4, 0x73, 0x5D, 0x9B, 0xEC, 0xB3, 0x9A, 0xF0},
+            {0x86, 0x42, 0x42, 0xEC, 0x3B, 0x8D, 0x00, 0x24},
+            {0x64, 0xF2, 0x21, 0xC0, 0x8E, 0x40, 0xC0, 0x08},
+            {0x85, 0x93, 0x45, 0x01, 0xAD, 0x07, 0x88, 0x05},
+            {0x00, 0xA2, 0x45, 0x00, 0x0A, 0x26, 0x10, 0x20},
+            {0x27, 0x80, 0x19, 0x50, 0x00, 0x34, 0x00, 0x24},
+            {0xD0, 0x05, 0x10, 0x01, 0x80, 0x02, 0x00, 0x03},
+            {0xA4, 0x00, 0x26, 0x40, 0x10, 0x72, 0x21, 0x10},
+            {0x24, 0x60, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00},
+            {0x01, 0x00, 0x04, 0x01, 0x00, 0x88, 0x40, 0xCA},
+            {0x20, 0x91, 0x42, 0x6A, 0x4C, 0x10, 0x95, 0x00},
+            {0x80, 0x18, 0x82, 0x92, 0xB2, 0xA2, 0x01, 0x22},
+            {0x22, 0x88, 0x80, 0x00, 0xE5, 0x33, 0xC2, 0x04},
+            {0x44, 0xD0, 0x18, 0x80, 0xA1, 0xA1, 0x00, 0x50},
+            {0x08, 0x18, 0x2C, 0x04, 0x50, 0xC1, 0x51, 0x44},
+            {0x84, 0x00, 0xC2, 0x00, 0x00, 0x40, 0x10, 0x00},
+            {0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x1D, 0xD2},
+            {0x01, 0x2B, 0x90, 0xA8, 0x00, 0xBD, 0x32, 0x24},
+            {0x4D, 0xC2, 0x43, 0x90, 0x23, 0xA1, 0x01, 0xC0},
+            {0x12, 0x02, 0xA1, 0x34, 0x0C, 0x8C, 0xC0, 0x00},
+            {0x10, 0x80, 0x1F, 0x50, 0x21, 0x90, 0x1A, 0x80},
+            {0xA0, 0x89, 0xCA, 0x00, 0x02, 0x04, 0x80, 0x33},
+            {0x6C, 0x11, 0x1B, 0x00, 0x28, 0x03, 0x40, 0x00},
+            {0x62, 0x00, 0x80, 0x00, 0xC4, 0xA1, 0x09, 0x00},
+            {0x01, 0x2A, 0x24, 0x05, 0x01, 0x40, 0x22, 0x04},
+            {0x20, 0x60, 0x04, 0x00, 0x00, 0x20, 0x01, 0xA0},
+            {0x00, 0x00, 0x10, 0x44, 0x00, 0x00, 0x80, 0x10},
+            {0x44, 0x00, 0x10, 0x10, 0x00, 0x01, 0x90, 0x00},
+            {0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x20},
+            {0x00, 0x04, 0x00, 0x80, 0x02, 0x04, 0x02, 0x00},
+            {0x80, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x00},
+            {0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x04, 0x44},
+            {0x80, 0x12, 0x00, 0x00, 0xFC, 0x04, 0x00, 0x1A},
+            {0x48, 0x0E, 0x40, 0x00, 0x00, 0x00, 0xB0, 0x80},
+            {0x22, 0xA8, 0xF4, 0x0A, 0x02, 0x88, 0x00, 0x00},
+            {0x00, 0x80, 0x5A, 0x88, 0xC4, 0xC1, 0x11, 0x01},
+            {0x87, 0x02, 0xA1, 0xE8, 0x13, 0x04, 0x05, 0x62},
+            {0x0E, 0x83, 0x00, 0x8A, 0xF2, 0x4C, 0x08, 0xFB},
+            {0x30, 0x16, 0x20, 0x48, 0x2E, 0x05, 0x29, 0x38},
+            {0x02, 0x08, 0x84, 0x48, 0x20, 0x04, 0x06, 0x78},
+            {0xE2, 0x4C, 0x0A, 0x06, 0x40, 0x46, 0x90, 0x01},
+            {0x24, 0x53, 0x20, 0xA8, 0xDA, 0x87, 0x24, 0x01},
+            {0x51, 0x18, 0x42, 0x01, 0x12, 0x58, 0x8A, 0x0A},
+            {0x20, 0x24, 0x91, 0x20, 0x1B, 0xA2, 0x10, 0x05},
+            {0x08, 0x20, 0x40, 0x09, 0x00, 0x00, 0x00, 0xC0},
+            {0x28, 0x02, 0x01, 0x10, 0x04, 0x84, 0x40, 0x04},
+            {0x82, 0x08, 0x1A, 0x44, 0x72, 0x03, 0x10, 0x00},
+            {0x44, 0x80, 0x18, 0x00, 0x01, 0x08, 0x0A, 0x40},
+            {0x00, 0x20, 0x00, 0x51, 0x40, 0x60, 0x00, 0x00},
+            {0x10, 0x41, 0x00, 0x10, 0x02, 0x00, 0x08, 0x00},
+            {0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x10, 0x00, 0x00, 0x00, 0xA8, 0x61, 0xD1},
+            {0x00, 0x46, 0x34, 0x02, 0x00, 0xF0, 0x08, 0x33},
+            {0x0E, 0x01, 0x00, 0x8B, 0xD0, 0xBA, 0x80, 0x22},
+            {0x00, 0x06, 0x20, 0x06, 0x40, 0x00, 0x41, 0x00},
+            {0x00, 0x50, 0x00, 0x40, 0x90, 0x40, 0x00, 0x20},
+            {0x10, 0x84, 0x10, 0x82, 0x00, 0x10, 0x00, 0x00},
+            {0x08, 0x40, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00},
+            {0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE2, 0x23},
+            {0x80, 0x11, 0x00, 0x8A, 0x86, 0x02, 0x24, 0x06},
+            {0x03, 0x04, 0x00, 0x00, 0x00, 0x90, 0x40, 0x02},
+            {0x14, 0x01, 0x81, 0x42, 0x03, 0x70, 0x03, 0x11},
+            {0x00, 0x40, 0x40, 0x18, 0x00, 0x4E, 0x10, 0xC0},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00},
+            {0x90, 0x0A, 0x40, 0x08, 0x00, 0x8A, 0x05, 0x08},
+            {0x00, 0x24, 0x01, 0x00, 0x01, 0x20, 0x00, 0x00},
+            {0x68, 0x02, 0x01, 0x00, 0x04, 0x00, 0x78, 0x10},
+            {0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x41, 0x00},
+            {0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x10, 0x5C, 0x40, 0xC0, 0x00},
+            {0x10, 0x00, 0x00, 0x95, 0x20, 0x2B, 0xAF, 0x09},
+            {0x20, 0x90, 0x10, 0x12, 0x60, 0x04, 0x10, 0x01},
+            {0x40, 0x80, 0x82, 0x86, 0x32, 0xC8, 0x24, 0x72},
+            {0xA0, 0x07, 0x34, 0x49, 0x04, 0x04, 0x11, 0x02},
+            {0x02, 0x00, 0x00, 0x80, 0x50, 0x0E, 0x10, 0x01},
+            {0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x69},
+            {0xD4, 0x08, 0x42, 0x00, 0x00, 0x40, 0x02, 0x80},
+            {0x64, 0xC5, 0xD7, 0x89, 0x00, 0xC0, 0x14, 0x51},
+            {0x02, 0x0A, 0x00, 0x80, 0x01, 0x83, 0xC0, 0x14},
+            {0x03, 0x00, 0x00, 0x08, 0x4A, 0x18, 0x00, 0x02},
+            {0x30, 0x40, 0x04, 0x00, 0xA0, 0x16, 0x08, 0x08},
+            {0x00, 0x00, 0x80, 0x08, 0x2C, 0x6A, 0x08, 0xE0},
+            {0x06, 0x30, 0x54, 0x04, 0x80, 0x00, 0x91, 0x41},
+            {0x21, 0x00, 0x24, 0x20, 0x00, 0x58, 0x80, 0x10},
+            {0x00, 0x72, 0x82, 0x81, 0x80, 0x00, 0x1B, 0x40},
+            {0x22, 0x0C, 0x21, 0x00, 0x00, 0x01, 0x80, 0x04},
+            {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54},
+            {0x02, 0x01, 0x40, 0xE0, 0x20, 0x21, 0x80, 0x01},
+            {0x12, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A},
+            {0x4B, 0x2A, 0x06, 0x81, 0xD0, 0x82, 0x01, 0x29},
+            {0x01, 0x68, 0x80, 0x04, 0x01, 0x00, 0x08, 0xB8},
+            {0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xD0, 0x84},
+            {0x1A, 0x20, 0xC6, 0xB1, 0x20, 0x00, 0x00, 0x80},
+            {0x00, 0x08, 0x40, 0xC2, 0x29, 0xA0, 0x00, 0x82},
+            {0x40, 0x08, 0x12, 0x08, 0x40, 0x11, 0x00, 0x14},
+            {0x00, 0x8A, 0x57, 0x08, 0x00, 0x00, 0x80, 0x42},
+            {0x01, 0x20, 0xB0, 0x00, 0x02, 0x22, 0x02, 0x00},
+            {0xC0, 0x00, 0x08, 0x02, 0x02, 0x40, 0x82, 0x00},
+            {0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80},
+            {0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x28},
+            {0x00, 0x02, 0xA4, 0x81, 0x30, 0x44, 0x0A, 0x42},
+            {0x00, 0x04, 0x60, 0x92, 0x01, 0x80, 0x00, 0x08},
+            {0x00, 0x04, 0x00, 0x00, 0x85, 0x88, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x04, 0x00, 0x00, 0x00, 0xD5, 0x9C, 0xEE, 0xA7},
+            {0xF8, 0xE5, 0x2E, 0xF7, 0xEC, 0x26, 0xB9, 0xB1},
+            {0x71, 0x42, 0x78, 0x25, 0x01, 0x43, 0x10, 0x05},
+            {0x00, 0x00, 0xA3, 0x04, 0x04, 0x46, 0x04, 0x00},
+            {0x00, 0x54, 0x10, 0x44, 0x12, 0x00, 0x00, 0x22},
+            {0x22, 0x10, 0x10, 0x81, 0x01, 0x00, 0x03, 0x18},
+            {0x2B, 0x30, 0xA1, 0x03, 0x00, 0x04, 0x48, 0xA9},
+            {0x04, 0x1C, 0x10, 0x05, 0x00, 0x04, 0x00, 0x00},
+            {0xD8, 0x1A, 0x40, 0x2D, 0x37, 0xC6, 0x04, 0xC4},
+            {0x4B, 0x50, 0x40, 0x54, 0x02, 0x80, 0x49, 0x25},
+            {0x44, 0x86, 0x4B, 0x04, 0x00, 0x80, 0x02, 0x41},
+            {0x40, 0x0C, 0x33, 0x00, 0x20, 0x40, 0x01, 0xCE},
+            {0x01, 0x84, 0x00, 0x39, 0x00, 0x01, 0x08, 0x00},
+            {0x4D, 0x00, 0x00, 0x00, 0x08, 0x24, 0x18, 0x18},
+            {0x61, 0x30, 0x14, 0xD0, 0x00, 0x14, 0xE3, 0x02},
+            {0x80, 0x00, 0x00, 0x01, 0x00, 0x80, 0x0D, 0x44},
+            {0x04, 0x28, 0x04, 0x30, 0x60, 0xB0, 0x0A, 0x22},
+            {0x80, 0xA0, 0x92, 0xC8, 0x60, 0x88, 0x02, 0x02},
+            {0x3E, 0x40, 0x00, 0x00, 0x80, 0x19, 0x60, 0x03},
+            {0x40, 0x02, 0x15, 0x04, 0x9A, 0x88, 0x80, 0x00},
+            {0x40, 0x42, 0x00, 0x00, 0x00, 0x08, 0x86, 0x22},
+            {0x80, 0x94, 0x00, 0x10, 0x01, 0x02, 0x06, 0x00},
+            {0x10, 0x70, 0x00, 0x20, 0xB0, 0x01, 0x00, 0x20},
+            {0x00, 0x00, 0x80, 0x08, 0x0A, 0x18, 0x22, 0x00},
+            {0x04, 0x08, 0x00, 0x12, 0x00, 0x00, 0x04, 0x01},
+            {0x10, 0x02, 0x42, 0xA0, 0x00, 0x10, 0x00, 0x00},
+            {0x00, 0x00, 0x8A, 0x04, 0x02, 0x18, 0x80, 0x30},
+            {0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40},
+            {0x10, 0x00, 0x00, 0x08, 0x00, 0x84, 0x00, 0x00},
+            {0x00, 0x82, 0x21, 0x00, 0x10, 0x02, 0x00, 0x08},
+            {0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01},
+            {0x00, 0xC0, 0x03, 0x44, 0x00, 0x08, 0x02, 0x62},
+            {0x07, 0x14, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00},
+            {0xC1, 0x0C, 0x10, 0x0A, 0x10, 0x40, 0x01, 0x42},
+            {0x05, 0x00, 0xA4, 0x11, 0x02, 0x00, 0x00, 0x00},
+            {0x80, 0x42, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00},
+            {0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
+            {0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00},
+            {0x21, 0x30, 0x90, 0x02, 0x2A, 0x19, 0x81, 0x00},
+            {0x12, 0x28, 0x44, 0x10, 0x00, 0x28, 0x02, 0x00},
+            {0x26, 0x00, 0x30, 0x02, 0x10, 0x00, 0x18, 0x03},
+            {0x04, 0x00, 0x05, 0x00, 0x20, 0x04, 0x00, 0x00},
+            {0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80},
+            {0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x76, 0x03, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00},
+            {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
+            {0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x3E, 0xEB, 0x4D, 0xF7},
+            {0x73, 0x37, 0xA2, 0x6C, 0xEE, 0xB8, 0xB6, 0x6D},
+            {0x6A, 0x6D, 0x89, 0x14, 0x5C, 0x33, 0x93, 0x00},
+            {0x42, 0x10, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06},
+            {0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0xE0, 0xFE, 0xFF, 0xB3, 0xD7},
+            {0x1E, 0xDC, 0x51, 0x4D, 0x5F, 0x08, 0xF1, 0x00},
+            {0x22, 0x0C, 0x00, 0x80, 0x08, 0x00, 0x18, 0x40},
+            {0x08, 0x18, 0x02, 0xA0, 0x00, 0x85, 0x28, 0x04},
+            {0x00, 0x94, 0x00, 0x40, 0x04, 0x06, 0x00, 0x00},
+            {0x10, 0x09, 0x00, 0x00, 0x40, 0x30, 0x04, 0x80},
+            {0x82, 0x00, 0x00, 0x00, 0x00, 0x98, 0x04, 0x04},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0xC0, 0xD3, 0x11, 0xA8},
+            {0x68, 0x07, 0xEB, 0xDA, 0x08, 0x0B, 0x03, 0x62},
+            {0xB6, 0x41, 0x13, 0xFB, 0x04, 0x2C, 0x81, 0x23},
+            {0x4F, 0x86, 0x95, 0xEC, 0x05, 0x40, 0x00, 0x59},
+            {0x86, 0xA0, 0x88, 0x00, 0x28, 0x60, 0x20, 0x80},
+            {0x01, 0x00, 0x0A, 0x00, 0x4C, 0xC4, 0x22, 0x0A},
+            {0x02, 0x44, 0x02, 0x20, 0x82, 0x21, 0x10, 0x21},
+            {0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x3A, 0x84, 0x64, 0x28, 0x54, 0xE2, 0x81},
+            {0x80, 0x0A, 0x04, 0x0C, 0x00, 0x00, 0x00, 0x00},
+            {0x80, 0xF6, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x43, 0x0C, 0xE2, 0xE7, 0x43, 0x2A, 0x48},
+            {0x6F, 0x00, 0x00, 0x30, 0x0A, 0x30, 0x47, 0x45},
+            {0x33, 0x19, 0x83, 0x06, 0x7A, 0xE1, 0x01, 0x0A},
+            {0x83, 0x24, 0x03, 0x10, 0x08, 0x20, 0x41, 0x80},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0xE5, 0x95, 0x2F},
+            {0x27, 0x42, 0x13, 0x90, 0x00, 0x40, 0x7C, 0x88},
+            {0xF1, 0x39, 0x21, 0x08, 0x16, 0x07, 0xE0, 0x00},
+            {0x60, 0x88, 0x11, 0x13, 0x80, 0x00, 0x40, 0x40},
+            {0xF3, 0xB0, 0x20, 0x00, 0x00, 0x05, 0xC0, 0x42},
+            {0x91, 0x22, 0x48, 0x50, 0x00, 0x00, 0x04, 0x03},
+            {0x00, 0x00, 0x44, 0x4A, 0x07, 0x02, 0x58, 0x00},
+            {0x00, 0x28, 0x00, 0x01, 0x01, 0x20, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0xC0, 0x22, 0x68, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE},
+            {0xF6, 0x05, 0xCB, 0x31, 0x91, 0x00, 0x00, 0x00},
+            {0x00, 0x40, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x67, 0x94},
+            {0x62, 0x89, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x5B, 0x5A},
+            {0xD4, 0x98, 0x82, 0x04, 0x12, 0x01, 0x00, 0x01},
+            {0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00},
+            {0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10},
+            {0x16, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10},
+            {0x02, 0x20, 0x00, 0x10, 0x10, 0x00, 0x00, 0x01},
+            {0x08, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x80, 0x6A, 0xA0, 0x28, 0xA0},
+            {0x28, 0x84, 0x00, 0x00, 0x10, 0x00, 0x01, 0x80},
+            {0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x08},
+            {0x10, 0x60, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x40, 0x08, 0x00, 0x01, 0x00, 0x00, 0x08},
+            {0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80},
+            {0x10, 0x08, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+            {0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+            {0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00},
+        };
+
+        const uint16_t GBK_BLOCK_BASES[BLOCK_COUNT] PROGMEM = {
+            0, 0, 0, 5, 19, 23, 25, 25, 33, 33, 33, 33,
+            35, 35, 35, 74, 83, 132, 149, 149, 149, 160, 160, 160,
+            160, 162, 174, 178, 178, 197, 205, 207, 207, 208, 208, 208,
+            208, 208, 230, 258, 258, 322, 334, 338, 343, 345, 347, 347,
+            347, 367, 430, 481, 537, 574, 574, 574, 574, 584, 584, 584,
+            584, 620, 646, 674, 704, 728, 748, 766, 782, 795, 803, 812,
+            818, 821, 852, 875, 899, 927, 943, 959, 970, 986, 1018, 1035,
+            1069, 1106, 1123, 1141, 1163, 1174, 1186, 1199, 1205, 1215, 1220, 1225,
+            1239, 1249, 1270, 1281, 1290, 1299, 1305, 1314, 1324, 1345, 1365, 1380,
+            1393, 1405, 1412, 1415, 1421, 1421, 1439, 1473, 1494, 1516, 1536, 1546,
+            1554, 1560, 1561, 1561, 1579, 1600, 1614, 1635, 1642, 1662, 1678, 1694,
+            1710, 1727, 1746, 1760, 1781, 1790, 1800, 1804, 1809, 1827, 1855, 1882,
+            1920, 1943, 1963, 1986, 1999, 2014, 2025, 2040, 2047, 2057, 2075, 2093,
+            2111, 2127, 2144, 2151, 2161, 2182, 2203, 2219, 2236, 2252, 2267, 2279,
+            2292, 2300, 2305, 2312, 2315, 2320, 2324, 2327, 2327, 2335, 2348, 2358,
+            2373, 2389, 2410, 2435, 2455, 2469, 2487, 2509, 2527, 2544, 2551, 2561,
+            2576, 2586, 2593, 2599, 2601, 2602, 2613, 2629, 2648, 2656, 2663, 2670,
+            2674, 2684, 2698, 2705, 2721, 2732, 2733, 2745, 2750, 2761, 2766, 2767,
+            2775, 2793, 2804, 2823, 2839, 2848, 2854, 2864, 2887, 2899, 2908, 2919,
+            2932, 2946, 2956, 2970, 2979, 2983, 2994, 3001, 3021, 3033, 3040, 3054,
+            3066, 3076, 3088, 3097, 3105, 3108, 3112, 3126, 3135, 3141, 3142, 3142,
+            3142, 3142, 3143, 3164, 3202, 3222, 3232, 3242, 3253, 3271, 3279, 3304,
+            3322, 3336, 3351, 3360, 3371, 3389, 3397, 3412, 3427, 3441, 3454, 3463,
+            3472, 3482, 3490, 3496, 3503, 3513, 3517, 3521, 3528, 3530, 3541, 3549,
+            3562, 3570, 3576, 3579, 3580, 3582, 3597, 3607, 3618, 3623, 3626, 3628,
+            3638, 3639, 3640, 3643, 3643, 3643, 3645, 3667, 3704, 3730, 3739, 3741,
+            3741, 3770, 3798, 3807, 3819, 3826, 3834, 3841, 3841, 3841, 3853, 3879,
+            3905, 3929, 3942, 3955, 3967, 3969, 3989, 3995, 4004, 4004, 4005, 4005,
+            4005, 4005, 4005, 4028, 4047, 4071, 4084, 4084, 4098, 4117, 4138, 4150,
+            4166, 4178, 4190, 4195, 4202, 4202, 4211, 4230, 4234, 4235, 4247, 4256,
+            4256, 4256, 4269, 4283, 4285, 4287, 4292, 4292, 4292, 4292, 4293, 4298,
+            4301, 4312, 4319, 4322, 4328, 4332, 4334, 4339, 4339, 4402, 4433, 4433,
+        };
+
+        const uint16_t GBK_CODES[CODE_COUNT] PROGMEM = {
+            0xA1E8, 0xA1EC, 0xA1A7, 0xA1E3, 0xA1C0, 0xA1C1, 0xA8A4, 0xA8A2, 0xA8A8, 0xA8A6, 0xA8BA, 0xA8AC,
+            0xA8AA, 0xA8B0, 0xA8AE, 0xA1C2, 0xA8B4, 0xA8B2, 0xA8B9, 0xA8A1, 0xA8A5, 0xA8A7, 0xA8A9, 0xA8AD,
+            0xA8B1, 0xA8A3, 0xA8AB, 0xA8AF, 0xA8B3, 0xA8B5, 0xA8B6, 0xA8B7, 0xA8B8, 0xA1A6, 0xA1A5, 0xA6A1,
+            0xA6A2, 0xA6A3, 0xA6A4, 0xA6A5, 0xA6A6, 0xA6A7, 0xA6A8, 0xA6A9, 0xA6AA, 0xA6AB, 0xA6AC, 0xA6AD,
+            0xA6AE, 0xA6AF, 0xA6B0, 0xA6B1, 0xA6B2, 0xA6B3, 0xA6B4, 0xA6B5, 0xA6B6, 0xA6B7, 0xA6B8, 0xA6C1,
+            0xA6C2, 0xA6C3, 0xA6C4, 0xA6C5, 0xA6C6, 0xA6C7, 0xA6C8, 0xA6C9, 0xA6CA, 0xA6CB, 0xA6CC, 0xA6CD,
+            0xA6CE, 0xA6CF, 0xA6D0, 0xA6D1, 0xA6D2, 0xA6D3, 0xA6D4, 0xA6D5, 0xA6D6, 0xA6D7, 0xA6D8, 0xA7A7,
+            0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A8, 0xA7A9, 0xA7AA, 0xA7AB, 0xA7AC, 0xA7AD,
+            0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1, 0xA7B2, 0xA7B3, 0xA7B4, 0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9,
+            0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE, 0xA7BF, 0xA7C0, 0xA7C1, 0xA7D1, 0xA7D2, 0xA7D3, 0xA7D4,
+            0xA7D5, 0xA7D6, 0xA7D8, 0xA7D9, 0xA7DA, 0xA7DB, 0xA7DC, 0xA7DD, 0xA7DE, 0xA7DF, 0xA7E0, 0xA7E1,
+            0xA7E2, 0xA7E3, 0xA7E4, 0xA7E5, 0xA7E6, 0xA7E7, 0xA7E8, 0xA7E9, 0xA7EA, 0xA7EB, 0xA7EC, 0xA7ED,
+            0xA7EE, 0xA7EF, 0xA7F0, 0xA7F1, 0xA7D7, 0xA1AA, 0xA1AC, 0xA1AE, 0xA1AF, 0xA1B0, 0xA1B1, 0xA1AD,
+            0xA1EB, 0xA1E4, 0xA1E5, 0xA1F9, 0xA1E6, 0xA1ED, 0xA2F1, 0xA2F2, 0xA2F3, 0xA2F4, 0xA2F5, 0xA2F6,
+            0xA2F7, 0xA2F8, 0xA2F9, 0xA2FA, 0xA2FB, 0xA2FC, 0xA1FB, 0xA1FC, 0xA1FA, 0xA1FD, 0xA1CA, 0xA1C7,
+            0xA1C6, 0xA1CC, 0xA1D8, 0xA1DE, 0xA1CF, 0xA1CE, 0xA1C4, 0xA1C5, 0xA1C9, 0xA1C8, 0xA1D2, 0xA1D3,
+            0xA1E0, 0xA1DF, 0xA1C3, 0xA1CB, 0xA1D7, 0xA1D6, 0xA1D5, 0xA1D9, 0xA1D4, 0xA1DC, 0xA1DD, 0xA1DA,
+            0xA1DB, 0xA1D1, 0xA1CD, 0xA1D0, 0xA2D9, 0xA2DA, 0xA2DB, 0xA2DC, 0xA2DD, 0xA2DE, 0xA2DF, 0xA2E0,
+            0xA2E1, 0xA2E2, 0xA2C5, 0xA2C6, 0xA2C7, 0xA2C8, 0xA2C9, 0xA2CA, 0xA2CB, 0xA2CC, 0xA2CD, 0xA2CE,
+            0xA2CF, 0xA2D0, 0xA2D1, 0xA2D2, 0xA2D3, 0xA2D4, 0xA2D5, 0xA2D6, 0xA2D7, 0xA2D8, 0xA2B1, 0xA2B2,
+            0xA2B3, 0xA2B4, 0xA2B5, 0xA2B6, 0xA2B7, 0xA2B8, 0xA2B9, 0xA2BA, 0xA2BB, 0xA2BC, 0xA2BD, 0xA2BE,
+            0xA2BF, 0xA2C0, 0xA2C1, 0xA2C2, 0xA2C3, 0xA2C4, 0xA9A4, 0xA9A5, 0xA9A6, 0xA9A7, 0xA9A8, 0xA9A9,
+            0xA9AA, 0xA9AB, 0xA9AC, 0xA9AD, 0xA9AE, 0xA9AF, 0xA9B0, 0xA9B1, 0xA9B2, 0xA9B3, 0xA9B4, 0xA9B5,
+            0xA9B6, 0xA9B7, 0xA9B8, 0xA9B9, 0xA9BA, 0xA9BB, 0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0, 0xA9C1,
+            0xA9C2, 0xA9C3, 0xA9C4, 0xA9C5, 0xA9C6, 0xA9C7, 0xA9C8, 0xA9C9, 0xA9CA, 0xA9CB, 0xA9CC, 0xA9CD,
+            0xA9CE, 0xA9CF, 0xA9D0, 0xA9D1, 0xA9D2, 0xA9D3, 0xA9D4, 0xA9D5, 0xA9D6, 0xA9D7, 0xA9D8, 0xA9D9,
+            0xA9DA, 0xA9DB, 0xA9DC, 0xA9DD, 0xA9DE, 0xA9DF, 0xA9E0, 0xA9E1, 0xA9E2, 0xA9E3, 0xA9E4, 0xA9E5,
+            0xA9E6, 0xA9E7, 0xA9E8, 0xA9E9, 0xA9EA, 0xA9EB, 0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0xA1F6, 0xA1F5,
+            0xA1F8, 0xA1F7, 0xA1F4, 0xA1F3, 0xA1F0, 0xA1F2, 0xA1F1, 0xA1EF, 0xA1EE, 0xA1E2, 0xA1E1, 0xA1A1,
+            0xA1A2, 0xA1A3, 0xA1A8, 0xA1A9, 0xA1B4, 0xA1B5, 0xA1B6, 0xA1B7, 0xA1B8, 0xA1B9, 0xA1BA, 0xA1BB,
+            0xA1BE, 0xA1BF, 0xA1FE, 0xA1B2, 0xA1B3, 0xA1BC, 0xA1BD, 0xA4A1, 0xA4A2, 0xA4A3, 0xA4A4, 0xA4A5,
+            0xA4A6, 0xA4A7, 0xA4A8, 0xA4A9, 0xA4AA, 0xA4AB, 0xA4AC, 0xA4AD, 0xA4AE, 0xA4AF, 0xA4B0, 0xA4B1,
+            0xA4B2, 0xA4B3, 0xA4B4, 0xA4B5, 0xA4B6, 0xA4B7, 0xA4B8, 0xA4B9, 0xA4BA, 0xA4BB, 0xA4BC, 0xA4BD,
+            0xA4BE, 0xA4BF, 0xA4C0, 0xA4C1, 0xA4C2, 0xA4C3, 0xA4C4, 0xA4C5, 0xA4C6, 0xA4C7, 0xA4C8, 0xA4C9,
+            0xA4CA, 0xA4CB, 0xA4CC, 0xA4CD, 0xA4CE, 0xA4CF, 0xA4D0, 0xA4D1, 0xA4D2, 0xA4D3, 0xA4D4, 0xA4D5,
+            0xA4D6, 0xA4D7, 0xA4D8, 0xA4D9, 0xA4DA, 0xA4DB, 0xA4DC, 0xA4DD, 0xA4DE, 0xA4DF, 0xA4E0, 0xA4E1,
+            0xA4E2, 0xA4E3, 0xA4E4, 0xA4E5, 0xA4E6, 0xA4E7, 0xA4E8, 0xA4E9, 0xA4EA, 0xA4EB, 0xA4EC, 0xA4ED,
+            0xA4EE, 0xA4EF, 0xA4F0, 0xA4F1, 0xA4F2, 0xA4F3, 0xA5A1, 0xA5A2, 0xA5A3, 0xA5A4, 0xA5A5, 0xA5A6,
+            0xA5A7, 0xA5A8, 0xA5A9, 0xA5AA, 0xA5AB, 0xA5AC, 0xA5AD, 0xA5AE, 0xA5AF, 0xA5B0, 0xA5B1, 0xA5B2,
+            0xA5B3, 0xA5B4, 0xA5B5, 0xA5B6, 0xA5B7, 0xA5B8, 0xA5B9, 0xA5BA, 0xA5BB, 0xA5BC, 0xA5BD, 0xA5BE,
+            0xA5BF, 0xA5C0, 0xA5C1, 0xA5C2, 0xA5C3, 0xA5C4, 0xA5C5, 0xA5C6, 0xA5C7, 0xA5C8, 0xA5C9, 0xA5CA,
+            0xA5CB, 0xA5CC, 0xA5CD, 0xA5CE, 0xA5CF, 0xA5D0, 0xA5D1, 0xA5D2, 0xA5D3, 0xA5D4, 0xA5D5, 0xA5D6,
+            0xA5D7, 0xA5D8, 0xA5D9, 0xA5DA, 0xA5DB, 0xA5DC, 0xA5DD, 0xA5DE, 0xA5DF, 0xA5E0, 0xA5E1, 0xA5E2,
+            0xA5E3, 0xA5E4, 0xA5E5, 0xA5E6, 0xA5E7, 0xA5E8, 0xA5E9, 0xA5EA, 0xA5EB, 0xA5EC, 0xA5ED, 0xA5EE,
+            0xA5EF, 0xA5F0, 0xA5F1, 0xA5F2, 0xA5F3, 0xA5F4, 0xA5F5, 0xA5F6, 0xA1A4, 0xA8C5, 0xA8C6, 0xA8C7,
+            0xA8C8, 0xA8C9, 0xA8CA, 0xA8CB, 0xA8CC, 0xA8CD, 0xA8CE, 0xA8CF, 0xA8D0, 0xA8D1, 0xA8D2, 0xA8D3,
+            0xA8D4, 0xA8D5, 0xA8D6, 0xA8D7, 0xA8D8, 0xA8D9, 0xA8DA, 0xA8DB, 0xA8DC, 0xA8DD, 0xA8DE, 0xA8DF,
+            0xA8E0, 0xA8E1, 0xA8E2, 0xA8E3, 0xA8E4, 0xA8E5, 0xA8E6, 0xA8E7, 0xA8E8, 0xA8E9, 0xA2E5, 0xA2E6,
+            0xA2E7, 0xA2E8, 0xA2E9, 0xA2EA, 0xA2EB, 0xA2EC, 0xA2ED, 0xA2EE, 0xD2BB, 0xB6A1, 0xC6DF, 0xCDF2,
+            0xD5C9, 0xC8FD, 0xC9CF, 0xCFC2, 0xB2BB, 0xD3EB, 0xB3F3, 0xD7A8, 0xC7D2, 0xCAC0, 0xC7F0, 0xB1FB,
+            0xD2B5, 0xB4D4, 0xB6AB, 0xCBBF, 0xB6AA, 0xC1BD, 0xD1CF, 0xC9A5, 0xB8F6, 0xD1BE, 0xD6D0, 0xB7E1,
+            0xB4AE, 0xC1D9, 0xCDE8, 0xB5A4, 0xCEAA, 0xD6F7, 0xC0F6, 0xBED9, 0xC4CB, 0xBEC3, 0xC3B4, 0xD2E5,
+            0xD6AE, 0xCEDA, 0xD5A7, 0xBAF5, 0xB7A6, 0xC0D6, 0xC6B9, 0xC5D2, 0xC7C7, 0xB9D4, 0xB3CB, 0xD2D2,
+            0xBEC5, 0xC6F2, 0xD2B2, 0xCFB0, 0xCFE7, 0xCAE9, 0xC2F2, 0xC2D2, 0xC8E9, 0xC7AC, 0xC1CB, 0xD3E8,
+            0xD5F9, 0xCAC2, 0xB6FE, 0xD3DA, 0xBFF7, 0xD4C6, 0xBBA5, 0xCEE5, 0xBEAE, 0xD1C7, 0xD0A9, 0xCDF6,
+            0xBFBA, 0xBDBB, 0xBAA5, 0xD2E0, 0xB2FA, 0xBAE0, 0xC4B6, 0xCFED, 0xBEA9, 0xCDA4, 0xC1C1, 0xC7D7,
+            0xC8CB, 0xD2DA, 0xCAB2, 0xC8CA, 0xBDF6, 0xC6CD, 0xB3F0, 0xBDF1, 0xBDE9, 0xC8D4, 0xB4D3, 0xC2D8,
+            0xB2D6, 0xD7D0, 0xCACB, 0xCBFB, 0xD5CC, 0xB8B6, 0xCFC9, 0xC7AA, 0xB4FA, 0xC1EE, 0xD2D4, 0xD2C7,
+            0xC3C7, 0xD1F6, 0xD6D9, 0xBCFE, 0xBCDB, 0xC8CE, 0xB7DD, 0xB7C2, 0xC6F3, 0xD2C1, 0xCEE9, 0xBCBF,
+            0xB7FC, 0xB7A5, 0xD0DD, 0xD6DA, 0xD3C5, 0xBBEF, 0xBBE1, 0xC9A1, 0xCEB0, 0xB4AB, 0xC9CB, 0xC2D7,
+            0xCEB1, 0xB2AE, 0xB9C0, 0xB0E9, 0xC1E6, 0xC9EC, 0xCBC5, 0xCBC6, 0xB5E8, 0xB5AB, 0xCEBB, 0xB5CD,
+            0xD7A1, 0xD7F4, 0xD3D3, 0xCCE5, 0xBACE, 0xD3E0, 0xB7F0, 0xD7F7, 0xC4E3, 0xD3B6, 0xC5E5, 0xC0D0,
+            0xD1F0, 0xB0DB, 0xBCD1, 0xCAB9, 0xD6B6, 0xB3DE, 0xC0FD, 0xCACC, 0xB6B1, 0xB9A9, 0xD2C0, 0xCFC0,
+            0xC2C2, 0xBDC4, 0xD5EC, 0xB2E0, 0xC7C8, 0xBFEB, 0xCEEA, 0xBAEE, 0xC7D6, 0xB1E3, 0xB4D9, 0xB6ED,
+            0xBFA1, 0xC7CE, 0xC0FE, 0xCBD7, 0xB7FD, 0xB1A3, 0xD3E1, 0xD0C5, 0xC1A9, 0xBCF3, 0xD0DE, 0xB8A9,
+            0xBEE3, 0xB0B3, 0xB1B6, 0xB5B9, 0xBEF3, 0xCCC8, 0xBAF2, 0xD2D0, 0xBDE8, 0xB3AB, 0xBEEB, 0xC4DF,
+            0xD5AE, 0xD6B5, 0xC7E3, 0xBCD9, 0xC6AB, 0xD7F6, 0xCDA3, 0xBDA1, 0xC5BC, 0xCDB5, 0xB3A5, 0xBFFE,
+            0xB8B5, 0xC0FC, 0xB0F8, 0xB4F6, 0xB4A2, 0xB4DF, 0xB0C1, 0xC9B5, 0xCFF1, 0xC1C5, 0xC9AE, 0xCBDB,
+            0xBDA9, 0xC6A7, 0xC8E5, 0xC0DC, 0xB6F9, 0xD4CA, 0xD4AA, 0xD0D6, 0xB3E4, 0xD5D7, 0xCFC8, 0xB9E2,
+            0xBFCB, 0xC3E2, 0xB6D2, 0xCDC3, 0xB5B3, 0xB6B5, 0xBEA4, 0xC8EB, 0xC8AB, 0xB0CB, 0xB9AB, 0xC1F9,
+            0xC0BC, 0xB9B2, 0xB9D8, 0xD0CB, 0xB1F8, 0xC6E4, 0xBEDF, 0xB5E4, 0xD7C8, 0xD1F8, 0xBCE6, 0xCADE,
+            0xBCBD, 0xC4DA, 0xB8D4, 0xC8BD, 0xB2E1, 0xD4D9, 0xC3B0, 0xC3E1, 0xC8DF, 0xD0B4, 0xBEFC, 0xC5A9,
+            0xB9DA, 0xD4A9, 0xB6AC, 0xB7EB, 0xB1F9, 0xB3E5, 0xBEF6, 0xBFF6, 0xD2B1, 0xC0E4, 0xB6B3, 0xBEBB,
+            0xC6E0, 0xD7BC, 0xC1B9, 0xB5F2, 0xC1E8, 0xBCF5, 0xB4D5, 0xC1DD, 0xC4FD, 0xBCB8, 0xB7B2, 0xB7EF,
+            0xC6BE, 0xBFAD, 0xBBCB, 0xB5CA, 0xD0D7, 0xCDB9, 0xB0BC, 0xB3F6, 0xBBF7, 0xBAAF, 0xD4E4, 0xB5B6,
+            0xB5F3, 0xC8D0, 0xB7D6, 0xC7D0, 0xBFAF, 0xD0CC, 0xBBAE, 0xC1D0, 0xC1F5, 0xD4F2, 0xB8D5, 0xB4B4,
+            0xB3F5, 0xC9BE, 0xC5D0, 0xC5D9, 0xC0FB, 0xB1F0, 0xB9CE, 0xB5BD, 0xD6C6, 0xCBA2, 0xC8AF, 0xC9B2,
+            0xB4CC, 0xBFCC, 0xB9F4, 0xB6E7, 0xBCC1, 0xCCEA, 0xCFF7, 0xC7B0, 0xB9D0, 0xBDA3, 0xCCDE, 0xC6CA,
+            0xB0FE, 0xBEE7, 0xCAA3, 0xBCF4, 0xB8B1, 0xB8EE, 0xBDCB, 0xC5FC, 0xC1A6, 0xC8B0, 0xB0EC, 0xB9A6,
+            0xBCD3, 0xCEF1, 0xC1D3, 0xB6AF, 0xD6FA, 0xC5AC, 0xBDD9, 0xC0F8, 0xBEA2, 0xC0CD, 0xCAC6, 0xB2AA,
+            0xD3C2, 0xC3E3, 0xD1AB, 0xC0D5, 0xBFB1, 0xC4BC, 0xC7DA, 0xC9D7, 0xB9B4, 0xCEF0, 0xD4C8, 0xB0FC,
+            0xB4D2, 0xD0D9, 0xBBAF, 0xB1B1, 0xB3D7, 0xD4D1, 0xBDB3, 0xBFEF, 0xCFBB, 0xB7CB, 0xC6A5, 0xC7F8,
+            0xD2BD, 0xC4E4, 0xCAAE, 0xC7A7, 0xC9FD, 0xCEE7, 0xBBDC, 0xB0EB, 0xBBAA, 0xD0AD, 0xB1B0, 0xD7E4,
+            0xD7BF, 0xB5A5, 0xC2F4, 0xC4CF, 0xB2A9, 0xB2B7, 0xB1E5, 0xD5BC, 0xBFA8, 0xC2AC, 0xC2B1, 0xCED4,
+            0xCEC0, 0xC3AE, 0xD3A1, 0xCEA3, 0xBCB4, 0xC8B4, 0xC2D1, 0xBEED, 0xD0B6, 0xC7E4, 0xB3A7, 0xB6F2,
+            0xCCFC, 0xC0FA, 0xC0F7, 0xD1B9, 0xD1E1, 0xB2DE, 0xC0E5, 0xBAF1, 0xD4AD, 0xCFE1, 0xCFC3, 0xB3F8,
+            0xBEC7, 0xC8A5, 0xCFD8, 0xC8FE, 0xB2CE, 0xD3D6, 0xB2E6, 0xBCB0, 0xD3D1, 0xCBAB, 0xB7B4, 0xB7A2,
+            0xCAE5, 0xC8A1, 0xCADC, 0xB1E4, 0xD0F0, 0xC5D1, 0xB5FE, 0xBFDA, 0xB9C5, 0xBEE4, 0xC1ED, 0xD6BB,
+            0xBDD0, 0xD5D9, 0xB0C8, 0xB6A3, 0xBFC9, 0xCCA8, 0xCAB7, 0xD3D2, 0xD2B6, 0xBAC5, 0xCBBE, 0xCCBE,
+            0xB5F0, 0xD3F5, 0xB3D4, 0xB8F7, 0xBACF, 0xBCAA, 0xB5F5, 0xCDAC, 0xC3FB, 0xBAF3, 0xC0F4, 0xCDC2,
+            0xCFF2, 0xCFC5, 0xC2C0, 0xC2F0, 0xBEFD, 0xC1DF, 0xCDCC, 0xD2F7, 0xB7CD, 0xB7F1, 0xB0C9, 0xB6D6,
+            0xB7D4, 0xBAAC, 0xCCFD, 0xBFD4, 0xCBB1, 0xC6F4, 0xD6A8, 0xCEE2, 0xB3B3, 0xCEFC, 0xB4B5, 0xCEC7,
+            0xBAF0, 0xCEE1, 0xD1BD, 0xB4F4, 0xB3CA, 0xB8E6, 0xC4C5, 0xC5BB, 0xD4B1, 0xC7BA, 0xCED8, 0xC4D8,
+            0xD6DC, 0xCEB6, 0xBAC7, 0xC5DE, 0xC9EB, 0xBAF4, 0xC3FC, 0xBED7, 0xC5D8, 0xD5A6, 0xBACD, 0xBECC,
+            0xD3BD, 0xB8C0, 0xD6E4, 0xB9BE, 0xBFA7, 0xC1FC, 0xD7C9, 0xD2A7, 0xBFA9, 0xD4DB, 0xBFC8, 0xCFCC,
+            0xD1CA, 0xB0A7, 0xC6B7, 0xBAE5, 0xB6DF, 0xCDDB, 0xB9FE, 0xD4D5, 0xCFEC, 0xB0A5, 0xD1C6, 0xBBA9,
+            0xD3B4, 0xB8E7, 0xC5B6, 0xC9DA, 0xC1A8, 0xC4C4, 0xBFDE, 0xCFF8, 0xD5DC, 0xB2B8, 0xBADF, 0xD1E4,
+            0xCBF4, 0xB4BD, 0xB0A6, 0xCCC6, 0xBBBD, 0xBBA3, 0xCADB, 0xCEA8, 0xB3AA, 0xCDD9, 0xBFD0, 0xD7C4,
+            0xC9CC, 0xB0A1, 0xB7C8, 0xC6A1, 0xC9B6, 0xC0B2, 0xC5BE, 0xC4F6, 0xD0A5, 0xCCE4, 0xBFA6, 0xCEB9,
+            0xC9C6, 0xC0AE, 0xBAED, 0xBAB0, 0xB4AD, 0xCFB2, 0xBAC8, 0xD0FA, 0xD4FB, 0xC5E7, 0xD3F7, 0xD0E1,
+            0xC9A4, 0xCAC8, 0xCECB, 0xCBC3, 0xCBD4, 0xBCCE, 0xB8C2, 0xD0EA, 0xC2EF, 0xD6F6, 0xB3B0, 0xD7EC,
+            0xCBBB, 0xCEFB, 0xBAD9, 0xD2AD, 0xC6F7, 0xD4EB, 0xCAC9, 0xB8C1, 0xBABF, 0xCCE7, 0xCFF9, 0xC8C2,
+            0xBDC0, 0xC4D2, 0xC7F4, 0xCBC4, 0xBBD8, 0xD2F2, 0xCDC5, 0xB6DA, 0xD4B0, 0xC0A7, 0xB4D1, 0xCEA7,
+            0xB9CC, 0xB9FA, 0xCDBC, 0xC6D4, 0xD4B2, 0xC8A6, 0xCDC1, 0xCAA5, 0xD4DA, 0xB9E7, 0xB5D8, 0xB3A1,
+            0xBBF8, 0xD6B7, 0xBEF9, 0xB7BB, 0xCCAE, 0xBFB2, 0xBBB5, 0xD7F8, 0xBFD3, 0xBFE9, 0xBCE1, 0xCCB3,
+            0xB0D3, 0xCEEB, 0xB7D8, 0xD7B9, 0xC6C2, 0xC0A4, 0xCCB9, 0xC6BA, 0xC5F7, 0xBFC0, 0xB4B9, 0xC0AC,
+            0xC2A2, 0xD0CD, 0xC0DD, 0xB6E2, 0xB9B8, 0xD4AB, 0xBFD1, 0xB5E6, 0xBFE5, 0xB9A1, 0xB0A3, 0xC2F1,
+            0xB3C7, 0xC6D2, 0xD3F2, 0xB2BA, 0xC5E0, 0xBBF9, 0xCCC3, 0xB6D1, 0xC7B5, 0xB6E9, 0xB1A4, 0xB5CC,
+            0xBFB0, 0xD1DF, 0xB6C2, 0xCBFA, 0xCBDC, 0xCBFE, 0xCCC1, 0xC8FB, 0xCCEE, 0xBEB3, 0xCAFB, 0xC9CA,
+            0xC4B9, 0xC7BD, 0xD4F6, 0xD0E6, 0xC4AB, 0xB6D5, 0xB1DA, 0xBABE, 0xC8C0, 0xCABF, 0xC8C9, 0xD7B3,
+            0xC9F9, 0xBFC7, 0xBAF8, 0xD2BC, 0xB4A6, 0xB1B8, 0xB8B4, 0xCFC4, 0xCFA6, 0xCDE2, 0xB6E0, 0xD2B9,
+            0xB9BB, 0xB4F3, 0xCCEC, 0xCCAB, 0xB7F2, 0xD1EB, 0xBABB, 0xCAA7, 0xCDB7, 0xD2C4, 0xBFE4, 0xBCD0,
+            0xB6E1, 0xD1D9, 0xC6E6, 0xC4CE, 0xB7EE, 0xB7DC, 0xBFFC, 0xD7E0, 0xC6F5, 0xB1BC, 0xBDB1, 0xCCD7,
+            0xB5EC, 0xC9DD, 0xB0C2, 0xC5AE, 0xC5AB, 0xC4CC, 0xBCE9, 0xCBFD, 0xBAC3, 0xC8E7, 0xCDFD, 0xD7B1,
+            0xB8BE, 0xC2E8, 0xC8D1, 0xB6CA, 0xBCCB, 0xD1FD, 0xC3EE, 0xCDD7, 0xB7C1, 0xC4DD, 0xC3C3, 0xC6DE,
+            0xC4B7, 0xCABC, 0xBDE3, 0xB9C3, 0xD0D5, 0xCEAF, 0xD2A6, 0xBDAA, 0xC0D1, 0xD2CC, 0xBCA7, 0xD2F6,
+            0xD7CB, 0xCDFE, 0xCDDE, 0xC2A6, 0xBDBF, 0xC4EF, 0xC4C8, 0xBEEA, 0xC9EF, 0xB6F0, 0xC3E4, 0xD3E9,
+            0xC8A2, 0xC6C5, 0xCDF1, 0xBBE9, 0xC0B7, 0xD3A4, 0xC9F4, 0xD0F6, 0xC3BD, 0xC3C4, 0xCFB1, 0xBCDE,
+            0xC9A9, 0xBCB5, 0xCFD3, 0xB5D5, 0xC4DB, 0xD7D3, 0xBFD7, 0xD4D0, 0xD7D6, 0xB4E6, 0xCBEF, 0xD7CE,
+            0xD0A2, 0xC3CF, 0xBCBE, 0xB9C2, 0xD1A7, 0xBAA2, 0xC2CF, 0xCAEB, 0xB7F5, 0xC8E6, 0xC4F5, 0xC4FE,
+            0xCBFC, 0xD5AC, 0xD3EE, 0xCAD8, 0xB0B2, 0xCBCE, 0xCDEA, 0xBAEA, 0xD7DA, 0xB9D9, 0xD6E6, 0xB6A8,
+            0xCDF0, 0xD2CB, 0xB1A6, 0xCAB5, 0xB3E8, 0xC9F3, 0xBFCD, 0xD0FB, 0xCAD2, 0xBBC2, 0xCFDC, 0xB9AC,
+            0xD4D7, 0xBAA6, 0xD1E7, 0xCFFC, 0xBCD2, 0xC8DD, 0xBFED, 0xB1F6, 0xCBDE, 0xBCC5, 0xBCC4, 0xD2FA,
+            0xC3DC, 0xBFDC, 0xB8BB, 0xC3C2, 0xBAAE, 0xD4A2, 0xC7DE, 0xC4AF, 0xB2EC, 0xB9D1, 0xC1C8, 0xD5AF,
+            0xB4E7, 0xB6D4, 0xCBC2, 0xD1B0, 0xB5BC, 0xCAD9, 0xB7E2, 0xC9E4, 0xBDAB, 0xCEBE, 0xD7F0, 0xD0A1,
+            0xC9D9, 0xB6FB, 0xBCE2, 0xB3BE, 0xC9D0, 0xB3A2, 0xD3C8, 0xD2A2, 0xBECD, 0xCAAC, 0xD2FC, 0xB3DF,
+            0xC4E1, 0xBEA1, 0xCEB2, 0xC4F2, 0xBED6, 0xC6A8, 0xB2E3, 0xBED3, 0xC7FC, 0xCCEB, 0xBDEC, 0xCEDD,
+            0xCABA, 0xC6C1, 0xD0BC, 0xD5B9, 0xCAF4, 0xCDC0, 0xC2C5, 0xC2C4, 0xCDCD, 0xC9BD, 0xD2D9, 0xD3EC,
+            0xCBEA, 0xC6F1, 0xB2ED, 0xB8DA, 0xB5BA, 0xD1D2, 0xC1EB, 0xD4C0, 0xB0B6, 0xBFF9, 0xD6C5, 0xCFBF,
+            0xC2CD, 0xB6EB, 0xD3F8, 0xC7CD, 0xB7E5, 0xBEFE, 0xB3E7, 0xC6E9, 0xB4DE, 0xD1C2, 0xB1C0, 0xD5B8,
+            0xC7B6, 0xCEA1, 0xB4A8, 0xD6DD, 0xD1B2, 0xB3B2, 0xB9A4, 0xD7F3, 0xC7C9, 0xBEDE, 0xB9AE, 0xCED7,
+            0xB2EE, 0xBCBA, 0xD2D1, 0xCBC8, 0xB0CD, 0xCFEF, 0xBDED, 0xB1D2, 0xCAD0, 0xB2BC, 0xCBA7, 0xB7AB,
+            0xCAA6, 0xCFA3, 0xD5CA, 0xC5C1, 0xCCFB, 0xC1B1, 0xD6E3, 0xB2AF, 0xD6C4, 0xB5DB, 0xB4F8, 0xD6A1,
+            0xCFAF, 0xB0EF, 0xB3A3, 0xC3B1, 0xC3DD, 0xB7F9, 0xBBCF, 0xC4BB, 0xB4B1, 0xB8C9, 0xC6BD, 0xC4EA,
+            0xB2A2, 0xD0D2, 0xBBC3, 0xD3D7, 0xD3C4, 0xB9E3, 0xD7AF, 0xC7EC, 0xB1D3, 0xB4B2, 0xD0F2, 0xC2AE,
+            0xBFE2, 0xD3A6, 0xB5D7, 0xB5EA, 0xC3ED, 0xB8FD, 0xB8AE, 0xC5D3, 0xB7CF, 0xB6C8, 0xD7F9, 0xCDA5,
+            0xCAFC, 0xBFB5, 0xD3B9, 0xC1AE, 0xC0C8, 0xC0AA, 0xC1CE, 0xD1D3, 0xCDA2, 0xBDA8, 0xBFAA, 0xD2EC,
+            0xC6FA, 0xC5AA, 0xB1D7, 0xCABD, 0xB9AD, 0xD2FD, 0xB8A5, 0xBAEB, 0xB3DA, 0xB5DC, 0xD5C5, 0xC3D6,
+            0xCFD2, 0xBBA1, 0xCDE4, 0xC8F5, 0xB5AF, 0xC7BF, 0xB9E9, 0xB5B1, 0xC2BC, 0xD2CD, 0xD0CE, 0xCDAE,
+            0xD1E5, 0xB2CA, 0xB1EB, 0xB1F2, 0xC5ED, 0xD5C3, 0xD3B0, 0xD2DB, 0xB3B9, 0xB1CB, 0xCDF9, 0xD5F7,
+            0xBEB6, 0xB4FD, 0xBADC, 0xBBB2, 0xC2C9, 0xD0EC, 0xCDBD, 0xB5C3, 0xC5C7, 0xD3F9, 0xD1AD, 0xCEA2,
+            0xB5C2, 0xBBD5, 0xD0C4, 0xB1D8, 0xD2E4, 0xBCC9, 0xC8CC, 0xD6BE, 0xCDFC, 0xC3A6, 0xD6D2, 0xD3C7,
+            0xBFEC, 0xB3C0, 0xC4EE, 0xD0C3, 0xBAF6, 0xB7DE, 0xBBB3, 0xCCAC, 0xCBCB, 0xD4F5, 0xC5AD, 0xD5FA,
+            0xC5C2, 0xB2C0, 0xC1AF, 0xCBBC, 0xB5A1, 0xBCB1, 0xD0D4, 0xD4B9, 0xB9D6, 0xC7D3, 0xD7DC, 0xCAD1,
+            0xC1B5, 0xBBD0, 0xBFD6, 0xBAE3, 0xCBA1, 0xBBD6, 0xD0F4, 0xBADE, 0xB6F7, 0xB6B2, 0xCCF1, 0xB9A7,
+            0xCFA2, 0xC7A1, 0xBFD2, 0xB6F1, 0xC4D5, 0xD3C1, 0xC7C4, 0xCFA4, 0xBAB7, 0xBBDA, 0xCEF2, 0xD3C6,
+            0xBBBC, 0xD4C3, 0xC4FA, 0xD0FC, 0xC3F5, 0xB1AF, 0xBCC2, 0xB5BF, 0xC7E9, 0xBEAA, 0xCDEF, 0xBBF3,
+            0xCCE8, 0xCFA7, 0xCEA9, 0xBBDD, 0xB5EB, 0xBEE5, 0xB2D2, 0xB3CD, 0xB1B9, 0xB2D1, 0xB5AC, 0xB9DF,
+            0xB6E8, 0xCFEB, 0xBBCC, 0xC8C7, 0xD0CA, 0xB3EE, 0xD3FA, 0xD3E4, 0xD2E2, 0xD3DE, 0xB8D0, 0xB7DF,
+            0xC0A2, 0xD4B8, 0xB4C8, 0xBBC5, 0xC9F7, 0xC9E5, 0xC4BD, 0xC2FD, 0xBBDB, 0xBFAE, 0xCEBF, 0xBFB6,
+            0xB1EF, 0xD4F7, 0xBAA9, 0xBAB6, 0xB6AE, 0xD0B8, 0xB0C3, 0xC0C1, 0xC5B3, 0xB8EA, 0xCEEC, 0xD0E7,
+            0xCAF9, 0xC8D6, 0xCFB7, 0xB3C9, 0xCED2, 0xBDE4, 0xBBF2, 0xD5BD, 0xC6DD, 0xBDD8, 0xC2BE, 0xB4C1,
+            0xB4F7, 0xBBA7, 0xB7BF, 0xCBF9, 0xB1E2, 0xC9C8, 0xCAD6, 0xB2C5, 0xD4FA, 0xC6CB, 0xB0C7, 0xB4F2,
+            0xC8D3, 0xCDD0, 0xBFB8, 0xBFDB, 0xC7A4, 0xD6B4, 0xC0A9, 0xC9A8, 0xD1EF, 0xC5A4, 0xB0E7, 0xB3B6,
+            0xC8C5, 0xB0E2, 0xB7F6, 0xC5FA, 0xB6F3, 0xD5D2, 0xB3D0, 0xBCBC, 0xB3AD, 0xBEF1, 0xB0D1, 0xD2D6,
+            0xCAE3, 0xD7A5, 0xCDB6, 0xB6B6, 0xBFB9, 0xD5DB, 0xB8A7, 0xC5D7, 0xBFD9, 0xC2D5, 0xC7C0, 0xBBA4,
+            0xB1A8, 0xC5EA, 0xC5FB, 0xCCA7, 0xB1A7, 0xB5D6, 0xC4A8, 0xD1BA, 0xB3E9, 0xC3F2, 0xB7F7, 0xD6F4,
+            0xB5A3, 0xB2F0, 0xC4B4, 0xC4E9, 0xC0AD, 0xB0E8, 0xC5C4, 0xC1E0, 0xB9D5, 0xBEDC, 0xCDD8, 0xB0CE,
+            0xCDCF, 0xBED0, 0xD7BE, 0xD5D0, 0xB0DD, 0xC4E2, 0xC2A3, 0xBCF0, 0xD3B5, 0xC0B9, 0xC5A1, 0xB2A6,
+            0xD4F1, 0xC0A8, 0xCAC3, 0xD5FC, 0xB9B0, 0xC8AD, 0xCBA9, 0xBFBD, 0xC6B4, 0xD7A7, 0xCAB0, 0xC4C3,
+            0xB3D6, 0xB9D2, 0xD6B8, 0xB0B4, 0xBFE6, 0xCCF4, 0xCDDA, 0xD6BF, 0xC2CE, 0xCECE, 0xCCA2, 0xD0AE,
+            0xC4D3, 0xB5B2, 0xD5F5, 0xBCB7, 0xBBD3, 0xB0A4, 0xC5B2, 0xB4EC, 0xD5F1, 0xCDA6, 0xCDEC, 0xCEE6,
+            0xCDB1, 0xC0A6, 0xD7BD, 0xB0C6, 0xBAB4, 0xC9D3, 0xC4F3, 0xBEE8, 0xB2B6, 0xC0CC, 0xCBF0, 0xBCF1,
+            0xBBBB, 0xB5B7, 0xC5F5, 0xBEDD, 0xB4B7, 0xBDDD, 0xC4ED, 0xCFC6, 0xB5E0, 0xB6DE, 0xCADA, 0xB5F4,
+            0xD5C6, 0xCCCD, 0xC6FE, 0xC5C5, 0xD2B4, 0xBEF2, 0xC2D3, 0xCCBD, 0xB3B8, 0xBDD3, 0xBFD8, 0xCDC6,
+            0xD1DA, 0xB4EB, 0xC2B0, 0xD6C0, 0xB5A7, 0xB2F4, 0xC8E0, 0xD7E1, 0xC3E8, 0xCCE1, 0xB2E5, 0xD2BE,
+            0xCED5, 0xB4A7, 0xBFAB, 0xBEBE, 0xBDD2, 0xD4AE, 0xC0BF, 0xB2F3, 0xB8E9, 0xC2A7, 0xBDC1, 0xB2AB,
+            0xB4A4, 0xB4EA, 0xC9A6, 0xCBD1, 0xB8E3, 0xCCC2, 0xB0E1, 0xB4EE, 0xD0AF, 0xB2EB, 0xC9E3, 0xB0DA,
+            0xD2A1, 0xB1F7, 0xCCAF, 0xCBA4, 0xD5AA, 0xB4DD, 0xC4A6, 0xC3FE, 0xC4A1, 0xC1CC, 0xBEEF, 0xC6B2,
+            0xB3C5, 0xC8F6, 0xCBBA, 0xD7B2, 0xB3B7, 0xC1C3, 0xC7CB, 0xB2A5, 0xB4E9, 0xD7AB, 0xC4EC, 0xBAB3,
+            0xC0DE, 0xC9C3, 0xB2D9, 0xC7E6, 0xC7DC, 0xCBD3, 0xB2C1, 0xC5CA, 0xD4DC, 0xC8C1, 0xBEF0, 0xD6A7,
+            0xCAD5, 0xB8C4, 0xB9A5, 0xB7C5, 0xD5FE, 0xB9CA, 0xD0A7, 0xB5D0, 0xC3F4, 0xBEC8, 0xB0BD, 0xBDCC,
+            0xC1B2, 0xB1D6, 0xB3A8, 0xB8D2, 0xC9A2, 0xB6D8, 0xBEB4, 0xCAFD, 0xC7C3, 0xD5FB, 0xB7F3, 0xCEC4,
+            0xD5AB, 0xB1F3, 0xB0DF, 0xB6B7, 0xC1CF, 0xD0B1, 0xD5E5, 0xCED3, 0xBDEF, 0xB3E2, 0xB8AB, 0xD5B6,
+            0xB6CF, 0xCBB9, 0xD0C2, 0xB7BD, 0xCAA9, 0xC5D4, 0xC2C3, 0xD0FD, 0xD7E5, 0xC6EC, 0xCEDE, 0xBCC8,
+            0xC8D5, 0xB5A9, 0xBEC9, 0xD6BC, 0xD4E7, 0xD1AE, 0xD0F1, 0xBAB5, 0xCAB1, 0xBFF5, 0xCDFA, 0xB0BA,
+            0xC0A5, 0xB2FD, 0xC3F7, 0xBBE8, 0xD2D7, 0xCEF4, 0xD0C7, 0xD3B3, 0xB4BA, 0xC3C1, 0xD7F2, 0xD5D1,
+            0xCAC7, 0xD6E7, 0xCFD4, 0xBBCE, 0xBDFA, 0xC9CE, 0xC9B9, 0xCFFE, 0xD4CE, 0xCDED, 0xCEEE, 0xBBDE,
+            0xB3BF, 0xC6D5, 0xBEB0, 0xCEFA, 0xC7E7, 0xBEA7, 0xD6C7, 0xC1C0, 0xD4DD, 0xCFBE, 0xCAEE, 0xC5AF,
+            0xB0B5, 0xC4BA, 0xB1A9, 0xCAEF, 0xC6D8, 0xD4BB, 0xC7FA, 0xD2B7, 0xB8FC, 0xB2DC, 0xC2FC, 0xD4F8,
+            0xCCE6, 0xD7EE, 0xD4C2, 0xD3D0, 0xC5F3, 0xB7FE, 0xCBB7, 0xC0CA, 0xCDFB, 0xB3AF, 0xC6DA, 0xC4BE,
+            0xCEB4, 0xC4A9, 0xB1BE, 0xD4FD, 0xCAF5, 0xD6EC, 0xC6D3, 0xB6E4, 0xBBFA, 0xD0E0, 0xC9B1, 0xD4D3,
+            0xC8A8, 0xB8CB, 0xC9BC, 0xC0EE, 0xD0D3, 0xB2C4, 0xB4E5, 0xD5C8, 0xB6C5, 0xCAF8, 0xB8DC, 0xCCF5,
+            0xC0B4, 0xD1EE, 0xBABC, 0xB1AD, 0xBDDC, 0xCBC9, 0xB0E5, 0xBCAB, 0xB9B9, 0xCDF7, 0xCEF6, 0xD5ED,
+            0xC1D6, 0xC3B6, 0xB9FB, 0xD6A6, 0xCAE0, 0xD4E6, 0xC7B9, 0xB7E3, 0xBFDD, 0xBCDC, 0xBCCF, 0xB1FA,
+            0xB0D8, 0xC4B3, 0xB8CC, 0xC6E2, 0xC8BE, 0xC8E1, 0xB9F1, 0xD7F5, 0xC4FB, 0xB2E9, 0xBCED, 0xBFC2,
+            0xD6F9, 0xC1F8, 0xB2F1, 0xCAC1, 0xD5A4, 0xB1EA, 0xD5BB, 0xB6B0, 0xC0B8, 0xCAF7, 0xCBA8, 0xC6DC,
+            0xC0F5, 0xD0A3, 0xD6EA, 0xD1F9, 0xBACB, 0xB8F9, 0xB8F1, 0xD4D4, 0xB9F0, 0xCCD2, 0xCEA6, 0xBFF2,
+            0xB0B8, 0xD7C0, 0xCDA9, 0xC9A3, 0xBBB8, 0xBDDB, 0xB5B5, 0xC7C5, 0xBDB0, 0xD7AE, 0xCDB0, 0xC1BA,
+            0xC3B7, 0xB0F0, 0xB9A3, 0xC9D2, 0xC3CE, 0xCEE0, 0xC0E6, 0xCBF3, 0xCCDD, 0xD0B5, 0xCAE1, 0xBCEC,
+            0xC3DE, 0xC6E5, 0xB9F7, 0xB0F4, 0xD7D8, 0xBCAC, 0xC5EF, 0xCCC4, 0xC9AD, 0xC0E2, 0xBFC3, 0xB9D7,
+            0xD2CE, 0xD6B2, 0xD7B5, 0xBDB7, 0xCDD6, 0xD2AC, 0xB4AA, 0xB4BB, 0xD0A8, 0xB3FE, 0xC0E3, 0xBFAC,
+            0xC2A5, 0xB8C5, 0xD3DC, 0xC0C6, 0xB0F1, 0xD5A5, 0xC1F1, 0xC8B6, 0xBBB1, 0xBCF7, 0xB2DB, 0xB7AE,
+            0xD5C1, 0xC4A3, 0xBAE1, 0xD3A3, 0xC7C1, 0xB3C8, 0xCFF0, 0xB3F7, 0xCCB4, 0xCFAD, 0xC3CA, 0xC7B7,
+            0xB4CE, 0xBBB6, 0xD0C0, 0xC5B7, 0xD3FB, 0xC6DB, 0xBFEE, 0xD0AA, 0xC7B8, 0xB8E8, 0xD6B9, 0xD5FD,
+            0xB4CB, 0xB2BD, 0xCEE4, 0xC6E7, 0xCDE1, 0xB4F5, 0xCBC0, 0xBCDF, 0xD1EA, 0xB4F9, 0xD1B3, 0xCAE2,
+            0xB2D0, 0xD6B3, 0xC5B9, 0xB6CE, 0xD2F3, 0xB5EE, 0xBBD9, 0xD2E3, 0xCEE3, 0xC4B8, 0xC3BF, 0xB6BE,
+            0xB1C8, 0xB1CF, 0xB1D1, 0xC5FE, 0xB1D0, 0xC3AB, 0xD5B1, 0xBAC1, 0xCCBA, 0xCACF, 0xC3F1, 0xC3A5,
+            0xC6F8, 0xC4CA, 0xB7D5, 0xB7FA, 0xC7E2, 0xBAA4, 0xD1F5, 0xB0B1, 0xB5AA, 0xC2C8, 0xC7E8, 0xCBAE,
+            0xD3C0, 0xCDA1, 0xD6AD, 0xC7F3, 0xBBE3, 0xBABA, 0xCFAB, 0xC9C7, 0xBAB9, 0xD1B4, 0xC8EA, 0xB9AF,
+            0xBDAD, 0xB3D8, 0xCEDB, 0xCCC0, 0xCDF4, 0xCCAD, 0xBCB3, 0xD0DA, 0xC6FB, 0xB7DA, 0xC7DF, 0xD2CA,
+            0xCED6, 0xC9F2, 0xB3C1, 0xC6E3, 0xC9B3, 0xC5E6, 0xB9B5, 0xC3BB, 0xC5BD, 0xC1A4, 0xC2D9, 0xB2D7,
+            0xBBA6, 0xC4AD, 0xBEDA, 0xBAD3, 0xB7D0, 0xD3CD, 0xD6CE, 0xD5D3, 0xB9C1, 0xD5B4, 0xD1D8, 0xD0B9,
+            0xC7F6, 0xC8AA, 0xB2B4, 0xC3DA, 0xB7A8, 0xB7BA, 0xC5A2, 0xC5DD, 0xB2A8, 0xC6FC, 0xC4E0, 0xD7A2,
+            0xC0E1, 0xCCA9, 0xD3BE, 0xB1C3, 0xD0BA, 0xC6C3, 0xD4F3, 0xBDE0, 0xD1F3, 0xC8F7, 0xCFB4, 0xC2E5,
+            0xB6B4, 0xBDF2, 0xBAE9, 0xB6FD, 0xD6DE, 0xBBEE, 0xCDDD, 0xC7A2, 0xC5C9, 0xC1F7, 0xC7B3, 0xBDAC,
+            0xBDBD, 0xD7C7, 0xB2E2, 0xBCC3, 0xBBEB, 0xC5A8, 0xD5E3, 0xBFA3, 0xC6D6, 0xBAC6, 0xC0CB, 0xB8A1,
+            0xD4A1, 0xBAA3, 0xBDFE, 0xCDBF, 0xC4F9, 0xCFFB, 0xC9E6, 0xD3BF, 0xCFD1, 0xCCE9, 0xCCCE, 0xC0D4,
+            0xC1B0, 0xCED0, 0xBBC1, 0xB5D3, 0xC8F3, 0xBDA7, 0xD5C7, 0xC9AC, 0xB8A2, 0xD1C4, 0xD2BA, 0xBAAD,
+            0xBAD4, 0xB5ED, 0xD7CD, 0xCFFD, 0xC1DC, 0xCCCA, 0xCAE7, 0xC4D7, 0xCCD4, 0xB5AD, 0xD3D9, 0xD2F9,
+            0xB4E3, 0xBBB4, 0xC9EE, 0xB4BE, 0xBBEC, 0xD1CD, 0xCCED, 0xC7E5, 0xD4A8, 0xD7D5, 0xBDA5, 0xD3E6,
+            0xC9F8, 0xD3E5, 0xC7FE, 0xB6C9, 0xD4FC, 0xB2B3, 0xCEC2, 0xCEBC, 0xB8DB, 0xBFCA, 0xD3CE, 0xC3EC,
+            0xC5C8, 0xCDC4, 0xBAFE, 0xCFE6, 0xD5BF, 0xCDE5, 0xCAAA, 0xC0A3, 0xBDA6, 0xB8C8, 0xD4B4, 0xC1EF,
+            0xD2E7, 0xCFAA, 0xCBDD, 0xC8DC, 0xC4E7, 0xB3FC, 0xB5E1, 0xD7CC, 0xBBAC, 0xD7D2, 0xCCCF, 0xB9F6,
+            0xD6CD, 0xC2FA, 0xC2CB, 0xC0C4, 0xC2D0, 0xB1F5, 0xCCB2, 0xB5CE, 0xC6AF, 0xC6E1, 0xC2A9, 0xC0EC,
+            0xD1DD, 0xC4AE, 0xC2FE, 0xCAFE, 0xD5C4, 0xD1FA, 0xCEAB, 0xC5CB, 0xC7B1, 0xC2BA, 0xC1CA, 0xCCB6,
+            0xB3B1, 0xB3CE, 0xB3BA, 0xC5EC, 0xC0BD, 0xD4E8, 0xB0C4, 0xBCA4, 0xB1F4, 0xC6D9, 0xB9E0, 0xBBF0,
+            0xC3F0, 0xB5C6, 0xBBD2, 0xC1E9, 0xD4EE, 0xBEC4, 0xD7C6, 0xD4D6, 0xB2D3, 0xC2AF, 0xB4B6, 0xD1D7,
+            0xB3B4, 0xC8B2, 0xBFBB, 0xD6CB, 0xBEE6, 0xCCBF, 0xC5DA, 0xBEBC, 0xB1FE, 0xD5A8, 0xB5E3, 0xC1B6,
+            0xB3E3, 0xCBB8, 0xC0C3, 0xCCFE, 0xC1D2, 0xBAE6, 0xC0D3, 0xD6F2, 0xD1CC, 0xBFBE, 0xB7B3, 0xC9D5,
+            0xBBE2, 0xCCCC, 0xBDFD, 0xC8C8, 0xCFA9, 0xCDE9, 0xC5EB, 0xB7E9, 0xD1C9, 0xBAB8, 0xBBC0, 0xB1BA,
+            0xB7D9, 0xBDB9, 0xD1E6, 0xC8BB, 0xBBCD, 0xBCE5, 0xC9B7, 0xC3BA, 0xD5D5, 0xD6F3, 0xC9BF, 0xCFA8,
+            0xD0DC, 0xD1AC, 0xC8DB, 0xCEF5, 0xCAEC, 0xB0BE, 0xC8BC, 0xC1C7, 0xD1E0, 0xD4EF, 0xB1AC, 0xD7A6,
+            0xC5C0, 0xB0AE, 0xBEF4, 0xB8B8, 0xD2AF, 0xB0D6, 0xB5F9, 0xCBAC, 0xC6AC, 0xB0E6, 0xC5C6, 0xD1C0,
+            0xC5A3, 0xC4B2, 0xC4B5, 0xC0CE, 0xC4C1, 0xCEEF, 0xC9FC, 0xC7A3, 0xCCD8, 0xCEFE, 0xCFAC, 0xC0E7,
+            0xB6BF, 0xC8AE, 0xB7B8, 0xD7B4, 0xD3CC, 0xBFF1, 0xB5D2, 0xB1B7, 0xBAFC, 0xB9B7, 0xBED1, 0xC4FC,
+            0xBADD, 0xBDC6, 0xB6C0, 0xCFC1, 0xCAA8, 0xD5F8, 0xD3FC, 0xC0EA, 0xC0C7, 0xC1D4, 0xB2FE, 0xC3CD,
+            0xB2C2, 0xD0C9, 0xD6ED, 0xC3A8, 0xCFD7, 0xBAEF, 0xBBAB, 0xD4B3, 0xCCA1, 0xD0FE, 0xC2CA, 0xD3F1,
+            0xCDF5, 0xBEC1, 0xC2EA, 0xCDE6, 0xC3B5, 0xBBB7, 0xCFD6, 0xC1E1, 0xB2A3, 0xC9BA, 0xD5E4, 0xB7A9,
+            0xD6E9, 0xB0E0, 0xC7F2, 0xC0C5, 0xC0ED, 0xC1F0, 0xCBF6, 0xD7C1, 0xC1D5, 0xC7D9, 0xC5FD, 0xC5C3,
+            0xC7ED, 0xBAF7, 0xC8F0, 0xC9AA, 0xB9E5, 0xD1FE, 0xC1A7, 0xB9CF, 0xC6B0, 0xB0EA, 0xC8BF, 0xCDDF,
+            0xCECD, 0xC6BF, 0xB4C9, 0xD5E7, 0xB8CA, 0xC9F5, 0xCCF0, 0xC9FA, 0xC9FB, 0xD3C3, 0xCBA6, 0xB8A6,
+            0xB1C2, 0xCCEF, 0xD3C9, 0xBCD7, 0xC9EA, 0xB5E7, 0xC4D0, 0xB5E9, 0xBBAD, 0xB3A9, 0xBDE7, 0xCEB7,
+            0xC5CF, 0xC1F4, 0xD0F3, 0xC2D4, 0xC6E8, 0xB7AC, 0xB3EB, 0xBBFB, 0xBDAE, 0xCAE8, 0xD2C9, 0xC1C6,
+            0xB8ED, 0xBECE, 0xC5B1, 0xD1F1, 0xB0CC, 0xBDEA, 0xD2DF, 0xB4AF, 0xB7E8, 0xC6A3, 0xB4C3, 0xD5EE,
+            0xCCDB, 0xBED2, 0xBCB2, 0xB2A1, 0xD6A2, 0xD3B8, 0xBEB7, 0xC8AC, 0xD1F7, 0xD6CC, 0xBADB, 0xB6BB,
+            0xCDB4, 0xC6A6, 0xC1A1, 0xBBBE, 0xCCB5, 0xB3D5, 0xB1D4, 0xB4E1, 0xCEC1, 0xC1F6, 0xCADD, 0xB4F1,
+            0xB1F1, 0xCCB1, 0xD5CE, 0xC8B3, 0xB0A9, 0xD1A2, 0xB9EF, 0xB5C7, 0xB0D7, 0xB0D9, 0xD4ED, 0xB5C4,
+            0xBDD4, 0xBBCA, 0xB8DE, 0xB0A8, 0xCDEE, 0xC6A4, 0xD6E5, 0xC3F3, 0xD3DB, 0xD6D1, 0xC5E8, 0xD3AF,
+            0xD2E6, 0xB0BB, 0xD5B5, 0xD1CE, 0xBCE0, 0xBAD0, 0xBFF8, 0xB8C7, 0xB5C1, 0xC5CC, 0xCAA2, 0xC3CB,
+            0xC4BF, 0xB6A2, 0xC3A4, 0xD6B1, 0xCFE0, 0xC5CE, 0xB6DC, 0xCAA1, 0xC3BC, 0xBFB4, 0xD5E6, 0xC3DF,
+            0xD5A3, 0xD1A3, 0xC3D0, 0xBFF4, 0xBEEC, 0xCCF7, 0xD1DB, 0xD7C5, 0xD5F6, 0xBEA6, 0xCBAF, 0xB6BD,
+            0xC4C0, 0xBDDE, 0xB2C7, 0xB6C3, 0xC3E9, 0xB3F2, 0xCFB9, 0xC2F7, 0xC6B3, 0xC7C6, 0xD6F5, 0xB5C9,
+            0xCBB2, 0xCDAB, 0xD5B0, 0xB4A3, 0xC3AC, 0xCAB8, 0xD2D3, 0xD6AA, 0xBED8, 0xBDC3, 0xB6CC, 0xB0AB,
+            0xCAAF, 0xCEF9, 0xB7AF, 0xBFF3, 0xC2EB, 0xC9B0, 0xC6F6, 0xBFB3, 0xC5F8, 0xD1D0, 0xD7A9, 0xD1E2,
+            0xD5E8, 0xC5E9, 0xC6C6, 0xC9E9, 0xD4D2, 0xC0F9, 0xB4A1, 0xB9E8, 0xCEF8, 0xCBB6, 0xCFF5, 0xC1F2,
+            0xD3B2, 0xC8B7, 0xBCEF, 0xC5F0, 0xB5EF, 0xC2B5, 0xB0AD, 0xCBE9, 0xB1AE, 0xCDEB, 0xB5E2, 0xB5FA,
+            0xB1CC, 0xC5F6, 0xBCEE, 0xCCBC, 0xB2EA, 0xC4EB, 0xB4C5, 0xB0F5, 0xC0DA, 0xB4E8, 0xC5CD, 0xBFC4,
+            0xC4A5, 0xC1D7, 0xBBC7, 0xBDB8, 0xCABE, 0xC0F1, 0xC9E7, 0xC6EE, 0xC6ED, 0xD7E6, 0xD7A3, 0xC9F1,
+            0xCBEE, 0xCFE9, 0xC6B1, 0xBCC0, 0xB5BB, 0xBBF6, 0xBDFB, 0xC2BB, 0xB8A3, 0xD3ED, 0xC0EB, 0xC7DD,
+            0xBACC, 0xD0E3, 0xCBBD, 0xCDBA, 0xB8D1, 0xB1FC, 0xC7EF, 0xD6D6, 0xBFC6, 0xC3EB, 0xC3D8, 0xD7E2,
+            0xB3D3, 0xC7D8, 0xD1ED, 0xD6C8, 0xBBFD, 0xB3C6, 0xBDD5, 0xD2C6, 0xBBE0, 0xCFA1, 0xB3CC, 0xC9D4,
+            0xCBB0, 0xB0DE, 0xD6C9, 0xB3ED, 0xCEC8, 0xB5BE, 0xBCDA, 0xBBFC, 0xB8E5, 0xC4C2, 0xCBEB, 0xD1A8,
+            0xBEBF, 0xC7EE, 0xBFD5, 0xB4A9, 0xCDBB, 0xC7D4, 0xD5AD, 0xC7CF, 0xD2A4, 0xD6CF, 0xBDD1, 0xB4B0,
+            0xBEBD, 0xB4DC, 0xCED1, 0xBFDF, 0xBFFA, 0xC1FE, 0xC1A2, 0xCAFA, 0xD5BE, 0xBEBA, 0xBEB9, 0xD5C2,
+            0xBFA2, 0xCDAF, 0xBDDF, 0xB6CB, 0xD6F1, 0xB8CD, 0xB0CA, 0xCBF1, 0xD0A6, 0xB1CA, 0xB5D1, 0xB7FB,
+            0xB1BF, 0xB5DA, 0xBCE3, 0xC1FD, 0xB5C8, 0xBDEE, 0xB7A4, 0xBFF0, 0xD6FE, 0xCDB2, 0xB4F0, 0xB2DF,
+            0xC9B8, 0xBFEA, 0xB3EF, 0xC7A9, 0xBCF2, 0xB9BF, 0xB2AD, 0xBBFE, 0xCBE3, 0xB9DC, 0xC2E1, 0xBCFD,
+            0xCFE4, 0xD7AD, 0xC6AA, 0xC2A8, 0xB8DD, 0xB4DB, 0xC0BA, 0xC0E9, 0xC5F1, 0xB4D8, 0xBBC9, 0xB2BE,
+            0xBCAE, 0xC3D7, 0xC0E0, 0xD7D1, 0xB7DB, 0xC1A3, 0xC6C9, 0xB4D6, 0xD5B3, 0xCBDA, 0xD4C1, 0xD6E0,
+            0xB7E0, 0xC1B8, 0xC1BB, 0xBEAC, 0xB4E2, 0xBEAB, 0xBAFD, 0xB8E2, 0xCCC7, 0xB2DA, 0xC3D3, 0xD4E3,
+            0xBFB7, 0xC5B4, 0xCFB5, 0xCEC9, 0xCBD8, 0xCBF7, 0xBDF4, 0xD7CF, 0xC0DB, 0xD0F5, 0xB7B1, 0xD7EB,
+            0xBEC0, 0xBAEC, 0xCFCB, 0xD4BC, 0xBCB6, 0xBCCD, 0xC8D2, 0xCEB3, 0xB4BF, 0xC9B4, 0xB8D9, 0xC4C9,
+            0xD7DD, 0xC2DA, 0xB7D7, 0xD6BD, 0xCEC6, 0xB7C4, 0xC5A6, 0xCFDF, 0xC1B7, 0xD7E9, 0xC9F0, 0xCFB8,
+            0xD6AF, 0xD6D5, 0xB0ED, 0xC9DC, 0xD2EF, 0xBEAD, 0xB0F3, 0xC8DE, 0xBDE1, 0xC8C6, 0xBBE6, 0xB8F8,
+            0xD1A4, 0xC2E7, 0xBEF8, 0xBDCA, 0xCDB3, 0xBEEE, 0xD0E5, 0xCBE7, 0xCCD0, 0xBCCC, 0xBCA8, 0xD0F7,
+            0xD0F8, 0xB4C2, 0xC9FE, 0xCEAC, 0xC3E0, 0xB1C1, 0xB3F1, 0xD7DB, 0xD5C0, 0xC2CC, 0xD7BA, 0xBCEA,
+            0xC3E5, 0xC0C2, 0xBCA9, 0xB6D0, 0xBBBA, 0xB5DE, 0xC2C6, 0xB1E0, 0xD4B5, 0xB8BF, 0xB7EC, 0xB2F8,
+            0xD3A7, 0xCBF5, 0xC9C9, 0xBDC9, 0xB8D7, 0xC8B1, 0xB9DE, 0xCDF8, 0xBAB1, 0xC2DE, 0xB7A3, 0xB0D5,
+            0xD5D6, 0xD7EF, 0xD6C3, 0xCAF0, 0xD1F2, 0xC7BC, 0xC3C0, 0xB8E1, 0xC1E7, 0xD0DF, 0xCFDB, 0xC8BA,
+            0xB8FE, 0xD3F0, 0xCECC, 0xB3E1, 0xD2EE, 0xCFE8, 0xC7CC, 0xB5D4, 0xB4E4, 0xBAB2, 0xB0BF, 0xB7AD,
+            0xD2ED, 0xD2AB, 0xC0CF, 0xBFBC, 0xD5DF, 0xB6F8, 0xCBA3, 0xC4CD, 0xB8FB, 0xBAC4, 0xD4C5, 0xB0D2,
+            0xC5D5, 0xB6FA, 0xD2AE, 0xCBCA, 0xB3DC, 0xB5A2, 0xB9A2, 0xC4F4, 0xC1C4, 0xC1FB, 0xD6B0, 0xC1AA,
+            0xC6B8, 0xBEDB, 0xB4CF, 0xCBE0, 0xD2DE, 0xCBC1, 0xD5D8, 0xC8E2, 0xC0DF, 0xBCA1, 0xD0A4, 0xD6E2,
+            0xB6C7, 0xB8D8, 0xB8CE, 0xB3A6, 0xB9C9, 0xD6AB, 0xB7F4, 0xB7CA, 0xBCE7, 0xB7BE, 0xB0B9, 0xBFCF,
+            0xD3FD, 0xB7CE, 0xC9F6, 0xD6D7, 0xD5CD, 0xD0B2, 0xCEB8, 0xB5A8, 0xB1B3, 0xCCA5, 0xC5D6, 0xC5DF,
+            0xCAA4, 0xB0FB, 0xBAFA, 0xBFE8, 0xD2C8, 0xB8EC, 0xBDBA, 0xD0D8, 0xB0B7, 0xC4DC, 0xD6AC, 0xB4E0,
+            0xC2F6, 0xBCB9, 0xD4E0, 0xC6EA, 0xC4D4, 0xC5A7, 0xB2B1, 0xBDC5, 0xB8AC, 0xCDD1, 0xC1B3, 0xC6A2,
+            0xCCF3, 0xC0B0, 0xD2B8, 0xB8AF, 0xB8AD, 0xC7BB, 0xCDF3, 0xD0C8, 0xC8F9, 0xD1FC, 0xB8B9, 0xCFD9,
+            0xC4E5, 0xCCDA, 0xCDC8, 0xB0F2, 0xB2B2, 0xB8E0, 0xB1EC, 0xCCC5, 0xC4A4, 0xCFA5, 0xC5F2, 0xC9C5,
+            0xCDCE, 0xB1DB, 0xD3B7, 0xD2DC, 0xB3BC, 0xD7D4, 0xB3F4, 0xD6C1, 0xD6C2, 0xD5E9, 0xBECA, 0xD2A8,
+            0xBECB, 0xD3DF, 0xC9E0, 0xC9E1, 0xCAE6, 0xCCF2, 0xCBB4, 0xCEE8, 0xD6DB, 0xBABD, 0xB0E3, 0xBDA2,
+            0xB2D5, 0xB6E6, 0xB2B0, 0xCFCF, 0xB4AC, 0xCDA7, 0xCBD2, 0xC1BC, 0xBCE8, 0xC9AB, 0xD1DE, 0xD2D5,
+            0xB0AC, 0xBDDA, 0xD3F3, 0xC9D6, 0xC3A2, 0xCEDF, 0xD6A5, 0xBDE6, 0xC2AB, 0xB7D2, 0xB0C5, 0xD0BE,
+            0xBBA8, 0xB7BC, 0xC7DB, 0xD1BF, 0xCEAD, 0xB2D4, 0xCBD5, 0xD4B7, 0xCCA6, 0xC3E7, 0xBFC1, 0xB0FA,
+            0xB9B6, 0xC8F4, 0xBFE0, 0xC9BB, 0xB1BD, 0xD3A2, 0xC6BB, 0xD7C2, 0xC3AF, 0xB7B6, 0xC7D1, 0xC3A9,
+            0xBEA5, 0xBCEB, 0xB4C4, 0xC3A3, 0xB2E7, 0xD2F0, 0xB2E8, 0xC8D7, 0xC8E3, 0xBEA3, 0xB2DD, 0xBCF6,
+            0xBBC4, 0xC0F3, 0xBCD4, 0xB5B4, 0xC8D9, 0xBBE7, 0xD3AB, 0xD2F1, 0xD2A9, 0xBAC9, 0xC6CE, 0xC0F2,
+            0xC9AF, 0xC4AA, 0xC0B3, 0xC1AB, 0xBBF1, 0xD3A8, 0xC3A7, 0xB9BD, 0xBED5, 0xBEFA, 0xBACA, 0xB2CB,
+            0xB2A4, 0xC6D0, 0xC1E2, 0xB7C6, 0xCCD1, 0xC3C8, 0xC6BC, 0xCEAE, 0xC2DC, 0xD3A9, 0xD3AA, 0xCFF4,
+            0xC8F8, 0xC2E4, 0xD6F8, 0xB8F0, 0xC6CF, 0xB6AD, 0xBAF9, 0xD4E1, 0xB4D0, 0xBFFB, 0xB5D9, 0xBDAF,
+            0xC3C9, 0xCBE2, 0xC6D1, 0xD5F4, 0xD0EE, 0xC8D8, 0xCBF2, 0xB1CD, 0xC0B6, 0xBCBB, 0xC5EE, 0xC3EF,
+            0xC2FB, 0xD5E1, 0xCEB5, 0xB2CC, 0xC4E8, 0xCADF, 0xC7BE, 0xB0AA, 0xB1CE, 0xBDB6, 0xC8EF, 0xD4CC,
+            0xC0D9, 0xB1A1, 0xD1A6, 0xD0BD, 0xCAED, 0xBDE5, 0xB2D8, 0xC3EA, 0xC5BA, 0xCCD9, 0xB7AA, 0xD4E5,
+            0xC4A2, 0xD5BA, 0xBBA2, 0xC2B2, 0xC5B0, 0xC2C7, 0xD0E9, 0xD3DD, 0xB3E6, 0xCAAD, 0xBAE7, 0xCBE4,
+            0xCFBA, 0xCAB4, 0xD2CF, 0xC2EC, 0xCEC3, 0xB0F6, 0xB2CF, 0xD1C1, 0xD4E9, 0xD6FB, 0xC7F9, 0xC9DF,
+            0xB9C6, 0xB5B0, 0xBBD7, 0xCDDC, 0xD6EB, 0xB8F2, 0xC2F9, 0xD5DD, 0xD3BC, 0xB6EA, 0xCAF1, 0xB7E4,
+            0xD1D1, 0xCDC9, 0xCECF, 0xD6A9, 0xC3DB, 0xC0AF, 0xD3AC, 0xB2F5, 0xD0AB, 0xBBC8, 0xBAFB, 0xB5FB,
+            0xC8DA, 0xC3F8, 0xC2DD, 0xD0B7, 0xC8E4, 0xB4C0, 0xD1AA, 0xD0C6, 0xD0D0, 0xD1DC, 0xCFCE, 0xBDD6,
+            0xD1C3, 0xBAE2, 0xD2C2, 0xB2B9, 0xB1ED, 0xC9C0, 0xB3C4, 0xCBA5, 0xD6D4, 0xD4AC, 0xB0C0, 0xB4FC,
+            0xC5DB, 0xCCBB, 0xD0E4, 0xCDE0, 0xB1BB, 0xCFAE, 0xB8A4, 0xB2C3, 0xC1D1, 0xD7B0, 0xD2E1, 0xD4A3,
+            0xC8B9, 0xBFE3, 0xC9D1, 0xC5E1, 0xC2E3, 0xB9FC, 0xB9D3, 0xBAD6, 0xB0FD, 0xC8EC, 0xCDCA, 0xCFE5,
+            0xBDF3, 0xCEF7, 0xD2AA, 0xB8B2, 0xBCFB, 0xB9DB, 0xB9E6, 0xC3D9, 0xCAD3, 0xC0C0, 0xBEF5, 0xBDC7,
+            0xBDE2, 0xB4A5, 0xD1D4, 0xD5B2, 0xD3FE, 0xCCDC, 0xCAC4, 0xBEAF, 0xC6A9, 0xBCC6, 0xB6A9, 0xB8BC,
+            0xC8CF, 0xBCA5, 0xCCD6, 0xC8C3, 0xC6FD, 0xD1B5, 0xD2E9, 0xD1B6, 0xBCC7, 0xBDB2, 0xBBE4, 0xD1C8,
+            0xD0ED, 0xB6EF, 0xC2DB, 0xCBCF, 0xB7ED, 0xC9E8, 0xB7C3, 0xBEF7, 0xD6A4, 0xC6C0, 0xD7E7, 0xCAB6,
+            0xD5A9, 0xCBDF, 0xD5EF, 0xD6DF, 0xB4CA, 0xD2EB, 0xCAD4, 0xCAAB, 0xB3CF, 0xD6EF, 0xBBB0, 0xB5AE,
+            0xB9EE, 0xD1AF, 0xD2E8, 0xB8C3, 0xCFEA, 0xB2EF, 0xBDEB, 0xCEDC, 0xD3EF, 0xCEF3, 0xD3D5, 0xBBE5,
+            0xCBB5, 0xCBD0, 0xC7EB, 0xD6EE, 0xC5B5, 0xB6C1, 0xB7CC, 0xBFCE, 0xCBAD, 0xB5F7, 0xC1C2, 0xD7BB,
+            0xCCB8, 0xD2EA, 0xC4B1, 0xB5FD, 0xBBD1, 0xD0B3, 0xCEBD, 0xB2F7, 0xD1E8, 0xC3D5, 0xD0BB, 0xD2A5,
+            0xB0F9, 0xC7AB, 0xBDF7, 0xC3A1, 0xC3FD, 0xCCB7, 0xC0BE, 0xC6D7, 0xC7B4, 0xB9C8, 0xBBED, 0xB6B9,
+            0xCDE3, 0xCFF3, 0xBBBF, 0xBAC0, 0xD4A5, 0xB1AA, 0xB2F2, 0xBAD1, 0xC3B2, 0xB1B4, 0xD5EA, 0xB8BA,
+            0xB9B1, 0xB2C6, 0xD4F0, 0xCFCD, 0xB0DC, 0xD5CB, 0xBBF5, 0xD6CA, 0xB7B7, 0xCCB0, 0xC6B6, 0xB1E1,
+            0xB9BA, 0xD6FC, 0xB9E1, 0xB7A1, 0xBCFA, 0xCCF9, 0xB9F3, 0xB4FB, 0xC3B3, 0xB7D1, 0xBAD8, 0xD4F4,
+            0xBCD6, 0xBBDF, 0xC1DE, 0xC2B8, 0xD4DF, 0xD7CA, 0xC9DE, 0xB8B3, 0xB6C4, 0xCAEA, 0xC9CD, 0xB4CD,
+            0xC5E2, 0xC0B5, 0xD7B8, 0xD7AC, 0xC8FC, 0xD4DE, 0xD4F9, 0xC9C4, 0xD3AE, 0xB8D3, 0xB3E0, 0xC9E2,
+            0xBAD5, 0xD7DF, 0xB8B0, 0xD5D4, 0xB8CF, 0xC6F0, 0xB3C3, 0xB3AC, 0xD4BD, 0xC7F7, 0xCCCB, 0xC8A4,
+            0xD7E3, 0xC5BF, 0xD6BA, 0xD4BE, 0xB0CF, 0xB5F8, 0xC5DC, 0xBEE0, 0xB8FA, 0xBFE7, 0xB9F2, 0xC2B7,
+            0xCCF8, 0xBCF9, 0xB6E5, 0xD3BB, 0xB3EC, 0xCCA4, 0xBEE1, 0xCCDF, 0xB2C8, 0xD7D9, 0xCCE3, 0xB5B8,
+            0xCCA3, 0xB1C4, 0xB5C5, 0xB2E4, 0xB6D7, 0xB4DA, 0xD4EA, 0xB3F9, 0xC9ED, 0xB9AA, 0xC7FB, 0xB6E3,
+            0xCCC9, 0xB3B5, 0xD4FE, 0xB9EC, 0xD0F9, 0xD7AA, 0xC2D6, 0xC8ED, 0xBAE4, 0xD6E1, 0xC7E1, 0xD4D8,
+            0xBDCE, 0xBDCF, 0xB8A8, 0xC1BE, 0xB1B2, 0xBBD4, 0xB9F5, 0xB7F8, 0xBCAD, 0xCAE4, 0xD4AF, 0xCFBD,
+            0xD5B7, 0xD5DE, 0xD0C1, 0xB9BC, 0xB4C7, 0xB1D9, 0xC0B1, 0xB1E6, 0xB1E7, 0xB1E8, 0xB3BD, 0xC8E8,
+            0xB1DF, 0xC1C9, 0xB4EF, 0xC7A8, 0xD3D8, 0xC6F9, 0xD1B8, 0xB9FD, 0xC2F5, 0xD3AD, 0xD4CB, 0xBDFC,
+            0xB7B5, 0xBBB9, 0xD5E2, 0xBDF8, 0xD4B6, 0xCEA5, 0xC1AC, 0xB3D9, 0xCCF6, 0xB5CF, 0xC6C8, 0xB5FC,
+            0xCAF6, 0xC3D4, 0xB1C5, 0xBCA3, 0xD7B7, 0xCDCB, 0xCBCD, 0xCACA, 0xCCD3, 0xC4E6, 0xD1A1, 0xD1B7,
+            0xCDB8, 0xD6F0, 0xB5DD, 0xCDBE, 0xB6BA, 0xCDA8, 0xB9E4, 0xCAC5, 0xB3D1, 0xCBD9, 0xD4EC, 0xB7EA,
+            0xB4FE, 0xD2DD, 0xC2DF, 0xB1C6, 0xD3E2, 0xB6DD, 0xCBEC, 0xD3F6, 0xB1E9, 0xB6F4, 0xB5C0, 0xD2C5,
+            0xC7B2, 0xD2A3, 0xD4E2, 0xD5DA, 0xD7F1, 0xB1DC, 0xD1FB, 0xD2D8, 0xB5CB, 0xD0CF, 0xC4C7, 0xB0EE,
+            0xD0B0, 0xD3CA, 0xBAAA, 0xC7F1, 0xC9DB, 0xD7DE, 0xC1DA, 0xD3F4, 0xBDBC, 0xC0C9, 0xD6A3, 0xBAC2,
+            0xBFA4, 0xD4C7, 0xB2BF, 0xB9F9, 0xB3BB, 0xB5A6, 0xB6BC, 0xB6F5, 0xB1C9, 0xD3CF, 0xC7F5, 0xD7C3,
+            0xC5E4, 0xBEC6, 0xD0EF, 0xB7D3, 0xD4CD, 0xCCAA, 0xBAA8, 0xCBD6, 0xC0D2, 0xB3EA, 0xCDAA, 0xBDB4,
+            0xBDCD, 0xC3B8, 0xBFE1, 0xCBE1, 0xC4F0, 0xB4BC, 0xD7ED, 0xB4D7, 0xD0D1, 0xC3D1, 0xC8A9, 0xB2C9,
+            0xD3D4, 0xCACD, 0xC0EF, 0xD6D8, 0xD2B0, 0xC1BF, 0xBDF0, 0xB8AA, 0xBCF8, 0xD5EB, 0xB6A4, 0xC7A5,
+            0xB7B0, 0xB5F6, 0xB8C6, 0xB6DB, 0xB3AE, 0xD6D3, 0xC4C6, 0xB1B5, 0xB8D6, 0xD4BF, 0xC7D5, 0xBEFB,
+            0xCED9, 0xB9B3, 0xC5A5, 0xC7AE, 0xC7AF, 0xB2A7, 0xD7EA, 0xBCD8, 0xD3CB, 0xCCFA, 0xB2AC, 0xC1E5,
+            0xC7A6, 0xC3AD, 0xCDAD, 0xC2C1, 0xD5A1, 0xCFB3, 0xB8F5, 0xC3FA, 0xBDC2, 0xD2BF, 0xB2F9, 0xD2F8,
+            0xD6FD, 0xC6CC, 0xC1B4, 0xCFFA, 0xCBF8, 0xB3FA, 0xB9F8, 0xD0E2, 0xB7E6, 0xD0BF, 0xC8F1, 0xCCE0,
+            0xD5E0, 0xB4ED, 0xC3AA, 0xCEFD, 0xC2E0, 0xB4B8, 0xD7B6, 0xBDF5, 0xCFC7, 0xB6A7, 0xBCFC, 0xBEE2,
+            0xC3CC, 0xC7C2, 0xB6CD, 0xB6C6, 0xC3BE, 0xD5F2, 0xC4F7, 0xC4F8, 0xB8E4, 0xB0F7, 0xBEB5, 0xC1CD,
+            0xC0D8, 0xC1AD, 0xCFE2, 0xB3A4, 0xC3C5, 0xC9C1, 0xB1D5, 0xCECA, 0xB4B3, 0xC8F2, 0xCFD0, 0xBCE4,
+            0xC3C6, 0xD5A2, 0xC4D6, 0xB9EB, 0xCEC5, 0xC3F6, 0xB7A7, 0xB8F3, 0xBAD2, 0xD4C4, 0xD1CB, 0xD1D6,
+            0xB2FB, 0xC0BB, 0xC0AB, 0xB8B7, 0xB6D3, 0xC8EE, 0xB7C0, 0xD1F4, 0xD2F5, 0xD5F3, 0xBDD7, 0xD7E8,
+            0xB0A2, 0xCDD3, 0xB8BD, 0xBCCA, 0xC2BD, 0xC2A4, 0xB3C2, 0xC2AA, 0xC4B0, 0xBDB5, 0xCFDE, 0xC9C2,
+            0xB1DD, 0xB6B8, 0xD4BA, 0xB3FD, 0xD4C9, 0xCFD5, 0xC5E3, 0xC1EA, 0xCCD5, 0xCFDD, 0xD3E7, 0xC2A1,
+            0xCBE5, 0xCBE6, 0xD2FE, 0xB8F4, 0xB0AF, 0xCFB6, 0xD5CF, 0xCBED, 0xC1A5, 0xC4D1, 0xC8B8, 0xD1E3,
+            0xD0DB, 0xD1C5, 0xBCAF, 0xB9CD, 0xB4C6, 0xD3BA, 0xB3FB, 0xB5F1, 0xD3EA, 0xD1A9, 0xC1E3, 0xC0D7,
+            0xB1A2, 0xCEED, 0xD0E8, 0xCFF6, 0xD5F0, 0xC3B9, 0xBBF4, 0xC4DE, 0xC1D8, 0xCBAA, 0xCFBC, 0xC2B6,
+            0xB0D4, 0xC5F9, 0xC7E0, 0xBEB8, 0xBEB2, 0xB5E5, 0xB7C7, 0xBFBF, 0xC3D2, 0xC3E6, 0xB8EF, 0xBDF9,
+            0xD1A5, 0xB0D0, 0xD0AC, 0xB0B0, 0xC7CA, 0xBECF, 0xB1DE, 0xCEA4, 0xC8CD, 0xBAAB, 0xBEC2, 0xD2F4,
+            0xD4CF, 0xC9D8, 0xD2B3, 0xB6A5, 0xC7EA, 0xCFEE, 0xCBB3, 0xD0EB, 0xCDE7, 0xB9CB, 0xB6D9, 0xB0E4,
+            0xCBCC, 0xD4A4, 0xC2AD, 0xC1EC, 0xC6C4, 0xBEB1, 0xBCD5, 0xD2C3, 0xC6B5, 0xCDC7, 0xD3B1, 0xBFC5,
+            0xCCE2, 0xD1D5, 0xB6EE, 0xB5DF, 0xB2FC, 0xC8A7, 0xB7E7, 0xC6AE, 0xB7C9, 0xCAB3, 0xB2CD, 0xBCA2,
+            0xB7B9, 0xD2FB, 0xBDA4, 0xCACE, 0xB1A5, 0xCBC7, 0xB6FC, 0xC8C4, 0xBDC8, 0xB1FD, 0xB6F6, 0xC4D9,
+            0xCFDA, 0xB9DD, 0xC0A1, 0xB2F6, 0xC1F3, 0xC2F8, 0xCAD7, 0xCFE3, 0xC2ED, 0xD4A6, 0xCDD4, 0xD1B1,
+            0xB3DB, 0xC7FD, 0xB2B5, 0xC2BF, 0xCABB, 0xBED4, 0xD7A4, 0xCDD5, 0xBCDD, 0xC2EE, 0xBDBE, 0xC2E6,
+            0xBAA7, 0xB3D2, 0xD1E9, 0xBFA5, 0xC6EF, 0xC6AD, 0xC9A7, 0xC2E2, 0xD6E8, 0xB9C7, 0xBAA1, 0xCBE8,
+            0xB8DF, 0xD7D7, 0xB9ED, 0xBFFD, 0xBBEA, 0xC6C7, 0xCEBA, 0xC4A7, 0xD3E3, 0xC2B3, 0xB1AB, 0xCFCA,
+            0xC0F0, 0xBEA8, 0xC8FA, 0xB1EE, 0xC1DB, 0xC4F1, 0xBCA6, 0xC3F9, 0xC5B8, 0xD1BB, 0xD1BC, 0xD1EC,
+            0xD4A7, 0xCDD2, 0xB8EB, 0xBAE8, 0xBEE9, 0xB6EC, 0xC8B5, 0xC5F4, 0xBAD7, 0xD3A5, 0xC2B9, 0xC2B4,
+            0xC2F3, 0xC2E9, 0xBBC6, 0xCAF2, 0xC0E8, 0xBADA, 0xC7AD, 0xC4AC, 0xB6A6, 0xB9C4, 0xCAF3, 0xB1C7,
+            0xC6EB, 0xB3DD, 0xC1E4, 0xC8A3, 0xC1FA, 0xB9A8, 0xB9EA, 0xA3A1, 0xA3A2, 0xA3A3, 0xA1E7, 0xA3A5,
+            0xA3A6, 0xA3A7, 0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD, 0xA3AE, 0xA3AF, 0xA3B0, 0xA3B1,
+            0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5, 0xA3B6, 0xA3B7, 0xA3B8, 0xA3B9, 0xA3BA, 0xA3BB, 0xA3BC, 0xA3BD,
+            0xA3BE, 0xA3BF, 0xA3C0, 0xA3C1, 0xA3C2, 0xA3C3, 0xA3C4, 0xA3C5, 0xA3C6, 0xA3C7, 0xA3C8, 0xA3C9,
+            0xA3CA, 0xA3CB, 0xA3CC, 0xA3CD, 0xA3CE, 0xA3CF, 0xA3D0, 0xA3D1, 0xA3D2, 0xA3D3, 0xA3D4, 0xA3D5,
+            0xA3D6, 0xA3D7, 0xA3D8, 0xA3D9, 0xA3DA, 0xA3DB, 0xA3DC, 0xA3DD, 0xA3DE, 0xA3DF, 0xA3E0, 0xA3E1,
+            0xA3E2, 0xA3E3, 0xA3E4, 0xA3E5, 0xA3E6, 0xA3E7, 0xA3E8, 0xA3E9, 0xA3EA, 0xA3EB, 0xA3EC, 0xA3ED,
+            0xA3EE, 0xA3EF, 0xA3F0, 0xA3F1, 0xA3F2, 0xA3F3, 0xA3F4, 0xA3F5, 0xA3F6, 0xA3F7, 0xA3F8, 0xA3F9,
+            0xA3FA, 0xA3FB, 0xA3FC, 0xA3FD, 0xA1AB, 0xA1E9, 0xA1EA, 0xA3FE, 0xA3A4,
+        };
+
+    };
+};
+
+#endif
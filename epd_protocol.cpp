@@ -0,0 +1,39 @@
+#include "epd_protocol.h"
+
+#include <string.h>
+
+namespace EPD {
+    namespace Protocol {
+        const uint8_t FRAME_END[4] = {0xCC, 0x33, 0xC3, 0x3C};
+
+        uint8_t calculateParityByte(const uint8_t *data, unsigned int length) {
+            uint8_t parityByte = 0x00;
+            for (unsigned int i = 0; i < length; ++i) {
+                parityByte ^= data[i];
+            }
+            return parityByte;
+        }
+
+        unsigned int encodeFrame(uint8_t *frame, Command command, const uint8_t *args, unsigned int argsLength) {
+            if (argsLength > MAX_ARGS_LENGTH)
+                return 0;
+
+            unsigned int frameLength = PREFIX_LENGTH + argsLength + SUFFIX_LENGTH;
+
+            frame[0] = FRAME_HEADER;
+
+            frame[1] = (frameLength >> 8) & 0xFF;
+            frame[2] = frameLength & 0xFF;
+
+            frame[3] = command;
+
+            if (argsLength > 0)
+                memcpy(frame + PREFIX_LENGTH, args, argsLength);
+
+            memcpy(frame + PREFIX_LENGTH + argsLength, FRAME_END, 4);
+            frame[frameLength - 1] = calculateParityByte(frame, frameLength - 1);
+
+            return frameLength;
+        }
+    };
+};
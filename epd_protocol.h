@@ -0,0 +1,107 @@
+/**
+ *  Protocol level definitions for the panel's serial command set. This header has no Arduino dependencies so
+ *  that host side code (see extras/host) can build and decode the same frames as Display.
+ *
+ *  Every frame is laid out as:
+ *      FRAME_HEADER | length (2 bytes, big endian, whole frame) | command | arguments | FRAME_END | parity
+ *  where the parity byte is the XOR of every byte before it.
+ */
+#ifndef EPD_PROTOCOL_h
+#define EPD_PROTOCOL_h
+
+#include <stdint.h>
+
+namespace EPD {
+
+    enum Color : uint8_t {
+        BLACK       = 0x00,
+        DARK_GREY   = 0x01,
+        LIGHT_GREY  = 0x02,
+        WHITE       = 0x03
+    };
+    
+    enum StorageArea : uint8_t {
+        NAND_FLASH  = 0x00,
+        MICRO_SD    = 0x01
+    };
+    
+    enum DisplayDirection : uint8_t {
+        NORMAL      = 0x00,
+        INVERTED    = 0x01
+    };
+    
+    enum FontSize : uint8_t {
+        DOTS_MATRIX_32  = 0x01,
+        DOTS_MATRIX_48  = 0x02,
+        DOTS_MATRIX_64  = 0x03
+    };
+    
+    enum Command : uint8_t {
+        /* System Control Commands */
+        HANDSHAKE               = 0x00,
+        SET_BAUD_RATE           = 0x01,
+        GET_BAUD_RATE           = 0x02,
+        GET_STORAGE_AREA        = 0x06,
+        SET_STORAGE_AREA        = 0x07,
+        ENTER_SLEEP             = 0x08,
+        REFRESH                 = 0x0A,
+        GET_DISP_DIRECTION      = 0x0C,
+        SET_DISP_DIRECTION      = 0x0D,
+        IMPORT_FONT_LIBRARY     = 0x0E,
+        IMPORT_IMAGE            = 0x0F,
+        
+        /* Display Parameter Configuration Commands */
+        SET_DRAWING_COLOR       = 0x10,
+        GET_DRAWING_COLOR       = 0x11,
+        GET_ENGLISH_FONT_SIZE   = 0x1C,
+        GET_CHINESE_FONT_SIZE   = 0x1D,
+        SET_ENGLISH_FONT_SIZE   = 0x1E,
+        SET_CHINESE_FONT_SIZE   = 0x1F,
+        
+        /* Basic Drawing Commands */
+        DRAW_POINT              = 0x20,
+        DRAW_LINE               = 0x22,
+        FILL_RECTANGLE          = 0x24,
+        DRAW_RECTANGLE          = 0x25,
+        DRAW_CIRCLE             = 0x26,
+        FILL_CIRCLE             = 0x27,
+        DRAW_TRIANGLE           = 0x28,
+        FILL_TRIANGLE           = 0x29,
+        CLEAR_SCREEN            = 0x2E,
+        DISPLAY_TEXT            = 0x30,
+        DISPLAY_IMAGE           = 0x70
+    };
+
+    namespace Protocol {
+        const uint8_t FRAME_HEADER = 0xA5;
+        extern const uint8_t FRAME_END[4];
+
+        /* header, two length bytes and the command byte */
+        const unsigned int PREFIX_LENGTH = 4;
+        /* frame end and the parity byte */
+        const unsigned int SUFFIX_LENGTH = 5;
+        const unsigned int MAX_FRAME_LENGTH = 1033;
+        const unsigned int MAX_ARGS_LENGTH = MAX_FRAME_LENGTH - PREFIX_LENGTH - SUFFIX_LENGTH;
+
+        uint8_t calculateParityByte(const uint8_t *data, unsigned int length);
+
+        /* Writes a complete frame to the given buffer, which must hold at least argsLength + 9 bytes, and
+           returns its length. Returns 0 if the arguments don't fit in MAX_FRAME_LENGTH. */
+        unsigned int encodeFrame(uint8_t *frame, Command command, const uint8_t *args, unsigned int argsLength);
+    };
+
+    /* Wire traces written by Display::setTraceOutput() are a sequence of records, each laid out as:
+           kind | timestamp in micros() (4 bytes, big endian) | payload length (2 bytes, big endian) | payload
+       TX records hold the bytes of one sendData() call, RX records the bytes read back for one response and
+       BAUD_RATE records the new baud rate (4 bytes, big endian) after setBaudRate(). */
+    namespace Trace {
+        const uint8_t TX        = 'T';
+        const uint8_t RX        = 'R';
+        const uint8_t BAUD_RATE = 'B';
+
+        const unsigned int RECORD_HEADER_LENGTH = 7;
+    };
+
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include "epd_text_field.h"
+
+namespace EPD {
+
+    TextField::TextField(Display &display, unsigned int x, unsigned int y, FontSize fontSize,
+            Color color, Color backgroundColor):display(display) {
+        this->x = x;
+        this->y = y;
+        this->fontSize = fontSize;
+        this->color = color;
+        this->backgroundColor = backgroundColor;
+        text[0] = 0x00;
+        length = 0;
+        dirtyLength = 0;
+        fontSizeApplied = false;
+    }
+
+    bool TextField::setup() {
+        bool success = display.setEnglishFontSize(fontSize);
+        success &= display.setChineseFontSize(fontSize);
+        fontSizeApplied = success;
+        return success;
+    }
+
+    bool TextField::update(const char *str) {
+        byte newLength = 0;
+        while (str[newLength] != 0x00 && newLength < MAX_LENGTH) {
+            ++newLength;
+        }
+        //don't cut a two byte character in half when truncating
+        unsigned long newTrail = trailByteMask(str, newLength);
+        if (newLength > 0 && (byte)str[newLength - 1] >= 0x80 && !(newTrail & (1UL << (newLength - 1)))) {
+            --newLength;
+        }
+        unsigned long oldTrail = trailByteMask(text, length);
+
+        byte cells = max(max(length, newLength), dirtyLength);
+        byte runStart[MAX_LENGTH / 2 + 1];
+        byte runEnd[MAX_LENGTH / 2 + 1];
+        byte runCount = 0;
+
+        byte i = 0;
+        while (i < cells) {
+            char oldChar = i < length ? text[i] : 0x00;
+            char newChar = i < newLength ? str[i] : 0x00;
+            if (i >= dirtyLength && oldChar == newChar) {
+                ++i;
+                continue;
+            }
+
+            byte start = i;
+            byte end = i + 1;
+            //extend the run over any changed cells that are close enough to be worth redrawing together
+            for (byte j = end; j < cells && j < end + MERGE_GAP; ++j) {
+                oldChar = j < length ? text[j] : 0x00;
+                newChar = j < newLength ? str[j] : 0x00;
+                if (j < dirtyLength || oldChar != newChar)
+                    end = j + 1;
+            }
+            //a two byte character in either the old or new string has to be blanked and redrawn as a whole
+            while (start > 0 && ((oldTrail | newTrail) & (1UL << start)))
+                --start;
+            while (end < cells && ((oldTrail | newTrail) & (1UL << end)))
+                ++end;
+
+            if (runCount > 0 && start <= runEnd[runCount - 1]) {
+                runEnd[runCount - 1] = end;
+            } else {
+                runStart[runCount] = start;
+                runEnd[runCount] = end;
+                ++runCount;
+            }
+            i = end;
+        }
+
+        bool success = true;
+        if (runCount > 0) {
+            //blank every changed cell first so each color change is only sent once
+            success &= display.setDrawingColor(backgroundColor, backgroundColor);
+            for (byte r = 0; r < runCount; ++r) {
+                success &= display.fillRectangle(x + runStart[r] * cellWidth(), y,
+                    x + runEnd[r] * cellWidth() - 1, y + cellHeight() - 1);
+            }
+            success &= display.setDrawingColor(color, backgroundColor);
+
+            //font sizes are only sent when they're needed and setup() hasn't already applied them
+            bool hasText = runStart[0] < newLength;
+            bool hasChinese = false;
+            for (byte r = 0; r < runCount && runStart[r] < newLength; ++r) {
+                for (byte j = runStart[r]; j < runEnd[r] && j < newLength; ++j) {
+                    if ((byte)str[j] >= 0x80)
+                        hasChinese = true;
+                }
+            }
+            if (hasText && !fontSizeApplied)
+                success &= display.setEnglishFontSize(fontSize);
+            if (hasChinese && !fontSizeApplied)
+                success &= display.setChineseFontSize(fontSize);
+
+            char buffer[MAX_LENGTH + 1];
+            for (byte r = 0; r < runCount && runStart[r] < newLength; ++r) {
+                byte end = min(runEnd[r], newLength);
+                memcpy(buffer, str + runStart[r], end - runStart[r]);
+                buffer[end - runStart[r]] = 0x00;
+                success &= display.displayText(x + runStart[r] * cellWidth(), y, buffer);
+            }
+        }
+
+        memcpy(text, str, newLength);
+        text[newLength] = 0x00;
+        length = newLength;
+        //if anything failed the panel's contents are unknown, so the next update has to redraw every cell
+        dirtyLength = success ? 0 : cells;
+
+        return success;
+    }
+
+    bool TextField::clear() {
+        return update("");
+    }
+
+    void TextField::invalidate() {
+        dirtyLength = length;
+    }
+
+    const char *TextField::getText() {
+        return text;
+    }
+
+
+    /* Private functions */
+
+    unsigned int TextField::cellWidth() {
+        return cellHeight() / 2;
+    }
+
+    unsigned int TextField::cellHeight() {
+        if (fontSize == FontSize::DOTS_MATRIX_64)
+            return 64;
+        else if (fontSize == FontSize::DOTS_MATRIX_48)
+            return 48;
+        else
+            return 32;
+    }
+
+    unsigned long TextField::trailByteMask(const char *str, byte length) {
+        unsigned long mask = 0;
+        for (byte i = 0; i < length; ++i) {
+            if ((byte)str[i] >= 0x80 && i + 1 < length) {
+                ++i;
+                mask |= 1UL << i;
+            }
+        }
+        return mask;
+    }
+};
@@ -0,0 +1,62 @@
+/**
+ *  TextField keeps track of the last string drawn at a fixed position so that an update only blanks and
+ *  redraws the character cells that actually changed. This is intended for values such as temperatures,
+ *  counters and clocks where only a few characters change between updates.
+ *
+ *  The panel's fonts are fixed width: an English (single byte) character is half as wide as the font height
+ *  and a Chinese (two byte GBK) character takes up two of those cells. Strings longer than MAX_LENGTH bytes
+ *  are truncated.
+ *
+ *  An update blanks the changed cells in the background color and then redraws them, so it always sends two
+ *  SET_DRAWING_COLOR frames and leaves the drawing color set to the field's colors. Unless setup() has been
+ *  called it also sets the English font size before drawing, and the Chinese font size if any of the redrawn
+ *  characters is a two byte one. Call setup() once if nothing else changes the panel's font sizes between
+ *  updates, so a one character change costs four frames: two colors, one FILL_RECTANGLE and one DISPLAY_TEXT.
+ *  Call setup() again whenever something else may have changed the font sizes.
+ */
+#ifndef EPD_TEXT_FIELD_h
+#define EPD_TEXT_FIELD_h
+
+#include "Arduino.h"
+#include "epd.h"
+
+namespace EPD {
+
+    class TextField {
+
+        public:
+            static const byte MAX_LENGTH = 32;
+
+            TextField(Display &display, unsigned int x, unsigned int y, FontSize fontSize,
+                Color color = Color::BLACK, Color backgroundColor = Color::WHITE);
+
+            bool setup();
+            bool update(const char *str);
+            bool clear();
+            void invalidate();
+            const char *getText();
+
+
+        private:
+            /* Unchanged runs shorter than this are redrawn along with their neighbours instead of splitting
+               the update into another pair of frames, since each frame costs far more than a few glyph bytes */
+            static const byte MERGE_GAP = 4;
+
+            Display &display;
+            unsigned int x;
+            unsigned int y;
+            FontSize fontSize;
+            Color color;
+            Color backgroundColor;
+            char text[MAX_LENGTH + 1];
+            byte length;
+            byte dirtyLength;
+            bool fontSizeApplied;
+            unsigned int cellWidth();
+            unsigned int cellHeight();
+            unsigned long trailByteMask(const char *str, byte length);
+    };
+
+};
+
+#endif
@@ -1,4 +1,6 @@
 #include <epd.h>
+#include <epd_text_field.h>
+#include <epd_chart.h>
 
 using namespace EPD;
 
@@ -113,6 +115,7 @@ void drawTextDemo() {
   buff[3] = '6';
   buff[4] = '4';
   disp.displayText(0, 160, buff);
+  disp.displayUtf8Text(0, 230, "UTF8: 你好世界"); //transcoded to the same GBK bytes as buff
   disp.displayText(0, 450, "ASCII48: Hello, World!");
 
 
@@ -120,6 +123,40 @@ void drawTextDemo() {
   delay(5000);
 }
 
+void drawTextFieldDemo() {
+  TextField counter(disp, 0, 50, FontSize::DOTS_MATRIX_64);
+  char buff[8];
+
+  disp.clearScreen();
+  counter.setup(); //nothing else changes the font size during the demo
+  for (int i = 95; i <= 105; i++)
+  {
+    itoa(i, buff, 10);
+    counter.update(buff); //only the digits that changed are blanked and redrawn
+    disp.refresh();
+    delay(5000);
+  }
+}
+
+void drawChartDemo() {
+  Chart line(disp, Chart::LINE, 0, 0, 799, 299, -100, 100, 2000);
+  Chart bars(disp, Chart::BAR, 0, 320, 799, 599, 0, 100, 2000, 20);
+
+  disp.setDrawingColor(Color::BLACK, Color::WHITE);
+  disp.clearScreen();
+  for (int i = 0; i < 2000; i++)
+  {
+    //2000 samples are reduced to one line per pixel column and one rectangle per bar before sending
+    int sample = (i % 200) - 100;
+    line.append(sample);
+    bars.append(abs(sample));
+  }
+  line.flush();
+  bars.flush();
+  disp.refresh();
+  delay(5000);
+}
+
 void drawImageDemo() {
   disp.clearScreen();
   disp.displayImage(0, 0, "PIC4.BMP");
@@ -144,6 +181,10 @@ void loop() {
 
   drawTextDemo();
 
+  drawTextFieldDemo();
+
+  drawChartDemo();
+
   drawImageDemo();
   
   disp.enterSleep();
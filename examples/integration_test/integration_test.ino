@@ -1,4 +1,7 @@
 #include <epd.h>
+#include <epd_chart.h>
+#include <epd_gbk.h>
+#include <epd_text_field.h>
 
 using namespace EPD;
 
@@ -9,6 +12,94 @@ void setup() {
   while(!Serial);
 }
 
+//Counts REFRESH frames in the wire trace by matching the fixed REFRESH packet
+class RefreshCounter : public Print {
+  public:
+    unsigned int count = 0;
+
+    size_t write(uint8_t b) {
+      static const byte REFRESH_PACKET[9] = {0xA5, 0x00, 0x09, Command::REFRESH, 0xCC, 0x33, 0xC3, 0x3C, 0xA6};
+      if (b == REFRESH_PACKET[matched]) {
+        if (++matched == sizeof(REFRESH_PACKET)) {
+          ++count;
+          matched = 0;
+        }
+      } else {
+        matched = (b == REFRESH_PACKET[0]) ? 1 : 0;
+      }
+      return 1;
+    }
+
+  private:
+    unsigned int matched = 0;
+};
+
+//Parses the wire trace and keeps the first MAX_FRAMES frames that were sent, so tests can check their contents
+class FrameRecorder : public Print {
+  public:
+    static const unsigned int MAX_FRAMES = 8;
+    static const unsigned int MAX_FRAME_LENGTH = 20;
+    unsigned int count = 0; //every frame sent, including the ones that weren't kept
+
+    void clear() {
+      count = 0;
+      position = 0;
+    }
+
+    byte command(unsigned int frame) {
+      return frames[frame][3];
+    }
+
+    unsigned int argument(unsigned int frame, unsigned int index) {
+      return (frames[frame][4 + 2 * index] << 8) | frames[frame][5 + 2 * index];
+    }
+
+    //the string sent by a DISPLAY_TEXT frame
+    const char *text(unsigned int frame) {
+      return (const char *)frames[frame] + 8;
+    }
+
+    unsigned int countCommand(byte command) {
+      unsigned int matches = 0;
+      for (unsigned int i = 0; i < count && i < MAX_FRAMES; ++i) {
+        if (frames[i][3] == command)
+          ++matches;
+      }
+      return matches;
+    }
+
+    size_t write(uint8_t b) {
+      if (position == 0) {
+        kind = b;
+      } else if (position == 5) {
+        length = b << 8;
+      } else if (position == 6) {
+        length |= b;
+      } else if (position >= Trace::RECORD_HEADER_LENGTH && kind == Trace::TX && count < MAX_FRAMES) {
+        unsigned int offset = position - Trace::RECORD_HEADER_LENGTH;
+        if (offset < MAX_FRAME_LENGTH - 1)
+          frames[count][offset] = b;
+      }
+
+      ++position;
+      if (position >= Trace::RECORD_HEADER_LENGTH && position == Trace::RECORD_HEADER_LENGTH + length) {
+        if (kind == Trace::TX) {
+          if (count < MAX_FRAMES)
+            frames[count][min(length, MAX_FRAME_LENGTH - 1)] = 0x00; //keeps text() terminated
+          ++count;
+        }
+        position = 0;
+      }
+      return 1;
+    }
+
+  private:
+    byte frames[MAX_FRAMES][MAX_FRAME_LENGTH];
+    unsigned int position = 0;
+    byte kind;
+    unsigned int length;
+};
+
 bool assertTrue(const char *errorMsg, bool success) {
   if (!success) {
     Serial.println(errorMsg);
@@ -66,11 +157,133 @@ bool testSetGetStorageArea() {
   return isSuccess;
 }
 
+bool testGbkTranscoding() {
+  char buff[16];
+  unsigned int size = Gbk::fromUtf8(buff, sizeof(buff), "你好");
+  bool isSuccess = assertEqual("fromUtf8 did not return 4 bytes for \"你好\"", 4, size);
+  isSuccess &= assertTrue("fromUtf8 did not transcode \"你好\" to C4 E3 BA C3",
+    (byte)buff[0] == 0xC4 && (byte)buff[1] == 0xE3 && (byte)buff[2] == 0xBA && (byte)buff[3] == 0xC3 && buff[4] == 0x00);
+
+  size = Gbk::fromUtf8(buff, sizeof(buff), "€"); //not in the panel's GB2312 fonts
+  isSuccess &= assertTrue("An unsupported character was not replaced with '?'", size == 1 && buff[0] == '?');
+
+  size = Gbk::fromUtf8(buff, sizeof(buff), "\xF0\x9F\x98\x80"); //a 4 byte sequence
+  isSuccess &= assertTrue("A 4 byte sequence was not replaced with a single '?'", size == 1 && buff[0] == '?');
+  return isSuccess;
+}
+
+bool testRequestRefreshCoalescing() {
+  RefreshCounter refreshCounter;
+  disp.setTraceOutput(&refreshCounter);
+  disp.setRefreshWindow(1000);
+  disp.setMinRefreshInterval(0);
+  unsigned long savedBefore = disp.getSavedRefreshCount();
+
+  bool isSuccess = assertTrue("The first requestRefresh did not return true", disp.requestRefresh());
+  isSuccess &= assertTrue("The second requestRefresh did not return true", disp.requestRefresh());
+  isSuccess &= assertTrue("No refresh was pending inside the window", disp.isRefreshPending());
+  isSuccess &= assertEqual("A REFRESH was sent inside the window", 0, refreshCounter.count);
+
+  delay(1100);
+  isSuccess &= assertTrue("serviceRefresh did not return true", disp.serviceRefresh());
+  isSuccess &= assertTrue("The refresh was still pending after the window", !disp.isRefreshPending());
+  isSuccess &= assertEqual("Two requests inside the window did not send exactly one REFRESH", 1, refreshCounter.count);
+  isSuccess &= assertEqual("getSavedRefreshCount did not go up by 1", savedBefore + 1, disp.getSavedRefreshCount());
+
+  disp.setTraceOutput(NULL);
+  return isSuccess;
+}
+
+bool testTextFieldUpdate() {
+  FrameRecorder recorder;
+  TextField field(disp, 10, 20, FontSize::DOTS_MATRIX_32); //16 pixel wide cells
+  bool isSuccess = assertTrue("TextField setup did not return true", field.setup());
+  isSuccess &= assertTrue("The first update did not return true", field.update("100"));
+
+  disp.setTraceOutput(&recorder);
+  isSuccess &= assertTrue("Updating \"100\" to \"101\" did not return true", field.update("101"));
+  isSuccess &= assertEqual("Updating \"100\" to \"101\" did not send 4 frames", 4, recorder.count);
+  isSuccess &= assertEqual("Updating \"100\" to \"101\" did not send one FILL_RECTANGLE", 1,
+    recorder.countCommand(Command::FILL_RECTANGLE));
+  isSuccess &= assertEqual("Updating \"100\" to \"101\" did not send one DISPLAY_TEXT", 1,
+    recorder.countCommand(Command::DISPLAY_TEXT));
+  isSuccess &= assertTrue("The FILL_RECTANGLE did not cover only the third cell",
+    recorder.command(1) == Command::FILL_RECTANGLE && recorder.argument(1, 0) == 42 && recorder.argument(1, 1) == 20
+      && recorder.argument(1, 2) == 57 && recorder.argument(1, 3) == 51);
+  isSuccess &= assertTrue("The DISPLAY_TEXT did not draw \"1\" in the third cell",
+    recorder.command(3) == Command::DISPLAY_TEXT && recorder.argument(3, 0) == 42 && strcmp(recorder.text(3), "1") == 0);
+
+  //C4 E3 and C4 E2 only differ in their trail byte, but the whole character still has to be redrawn
+  disp.setTraceOutput(NULL);
+  isSuccess &= assertTrue("Updating to \"a\\xC4\\xE3\" did not return true", field.update("a\xC4\xE3"));
+  recorder.clear();
+  disp.setTraceOutput(&recorder);
+  isSuccess &= assertTrue("Replacing a two byte character did not return true", field.update("a\xC4\xE2"));
+  isSuccess &= assertTrue("Replacing a two byte character did not blank both of its cells",
+    recorder.countCommand(Command::FILL_RECTANGLE) == 1 && recorder.command(1) == Command::FILL_RECTANGLE
+      && recorder.argument(1, 0) == 26 && recorder.argument(1, 2) == 57);
+  isSuccess &= assertTrue("Replacing a two byte character did not redraw it whole",
+    recorder.countCommand(Command::DISPLAY_TEXT) == 1 && recorder.command(3) == Command::DISPLAY_TEXT
+      && recorder.argument(3, 0) == 26 && strcmp(recorder.text(3), "\xC4\xE2") == 0);
+
+  disp.setTraceOutput(NULL);
+  field.clear();
+  return isSuccess;
+}
+
+bool testChartDecimation() {
+  FrameRecorder recorder;
+  disp.setTraceOutput(&recorder);
+
+  //2000 samples across 100 columns
+  Chart line(disp, Chart::Style::LINE, 0, 0, 99, 99, 0, 100, 2000);
+  bool isSuccess = true;
+  for (unsigned int i = 0; i < 2000; ++i) {
+    isSuccess &= line.append(i % 7 == 0 ? 100 : i % 50);
+  }
+  isSuccess &= line.flush();
+  isSuccess &= assertTrue("Appending 2000 samples to a LINE chart did not return true", isSuccess);
+  isSuccess &= assertTrue("2000 samples on a 100 pixel wide chart sent more than one frame per column",
+    recorder.count > 0 && recorder.count <= 100);
+
+  //4 samples across 10 columns leave a gap between the two that are appended and flushed one at a time
+  Chart area(disp, Chart::Style::AREA, 0, 0, 9, 99, 0, 100, 4);
+  isSuccess &= assertTrue("Appending to an AREA chart did not return true", area.append(50) && area.flush());
+  recorder.clear();
+  isSuccess &= assertTrue("Appending after a flush did not return true", area.append(60) && area.flush());
+  isSuccess &= assertEqual("Appending after a gap did not send 2 frames", 2, recorder.count);
+  isSuccess &= assertTrue("The gap was not filled at the previous column's height",
+    recorder.command(0) == Command::FILL_RECTANGLE && recorder.argument(0, 0) == 1 && recorder.argument(0, 1) == 50
+      && recorder.argument(0, 2) == 1 && recorder.argument(0, 3) == 99);
+  isSuccess &= assertTrue("The appended column was not drawn",
+    recorder.command(1) == Command::DRAW_LINE && recorder.argument(1, 0) == 2 && recorder.argument(1, 1) == 40);
+
+  //the whole int16_t range must not overflow while mapping values to rows
+  Chart wide(disp, Chart::Style::LINE, 0, 10, 2, 109, -32768, 32767, 3);
+  recorder.clear();
+  isSuccess &= assertTrue("Plotting the int16_t range did not return true",
+    wide.append(-32768) && wide.append(32767) && wide.append(0) && wide.flush());
+  isSuccess &= assertEqual("Plotting the int16_t range did not send 3 frames", 3, recorder.count);
+  isSuccess &= assertTrue("minValue was not drawn at y1",
+    recorder.command(0) == Command::DRAW_LINE && recorder.argument(0, 1) == 109 && recorder.argument(0, 3) == 109);
+  isSuccess &= assertTrue("maxValue was not drawn at y0",
+    recorder.command(1) == Command::DRAW_LINE && recorder.argument(1, 1) == 10);
+  isSuccess &= assertTrue("0 was not drawn halfway between y0 and y1",
+    recorder.command(2) == Command::DRAW_LINE && recorder.argument(2, 3) == 60);
+
+  disp.setTraceOutput(NULL);
+  return isSuccess;
+}
+
 
 bool (* tests [])() = {
   testHandshake, //Test 1
   testSetGetBaudRate,
-  testSetGetStorageArea
+  testSetGetStorageArea,
+  testGbkTranscoding,
+  testRequestRefreshCoalescing,
+  testTextFieldUpdate,
+  testChartDecimation
   
 };
 
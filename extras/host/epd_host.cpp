@@ -0,0 +1,428 @@
+#include "epd_host.h"
+
+#include <chrono>
+#include <system_error>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace EPD {
+    namespace Host {
+
+        static speed_t baudRateToSpeed(long baudRate) {
+            switch (baudRate) {
+                case 1200:      return B1200;
+                case 2400:      return B2400;
+                case 4800:      return B4800;
+                case 9600:      return B9600;
+                case 19200:     return B19200;
+                case 38400:     return B38400;
+                case 57600:     return B57600;
+                case 115200:    return B115200;
+                case 230400:    return B230400;
+                default:        return B0;
+            }
+        }
+
+        static long millisSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+
+
+
+        /* SerialPort */
+
+        SerialPort::SerialPort() {
+            fd = -1;
+        }
+
+        SerialPort::~SerialPort() {
+            close();
+        }
+
+        bool SerialPort::open(const char *device, long baudRate) {
+            close();
+            fd = ::open(device, O_RDWR | O_NOCTTY | O_CLOEXEC);
+            if (fd < 0)
+                return false;
+
+            if (!setBaudRate(baudRate)) {
+                close();
+                return false;
+            }
+            return true;
+        }
+
+        void SerialPort::close() {
+            if (fd >= 0)
+                ::close(fd);
+            fd = -1;
+        }
+
+        bool SerialPort::isOpen() {
+            return fd >= 0;
+        }
+
+        bool SerialPort::setBaudRate(long baudRate) {
+            speed_t speed = baudRateToSpeed(baudRate);
+            struct termios options;
+            if (speed == B0 || tcgetattr(fd, &options) != 0)
+                return false;
+
+            cfmakeraw(&options);
+            options.c_cflag |= CLOCAL | CREAD;
+            options.c_cflag &= ~CRTSCTS;
+            options.c_cc[VMIN] = 0;
+            options.c_cc[VTIME] = 0;
+            cfsetispeed(&options, speed);
+            cfsetospeed(&options, speed);
+
+            return tcsetattr(fd, TCSADRAIN, &options) == 0;
+        }
+
+        bool SerialPort::write(const uint8_t *data, unsigned int length) {
+            while (length > 0) {
+                ssize_t written = ::write(fd, data, length);
+                if (written < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                data += written;
+                length -= written;
+            }
+            return true;
+        }
+
+        unsigned int SerialPort::read(uint8_t *data, unsigned int length, int timeoutMs) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            unsigned int size = 0;
+            while (size < length) {
+                long remaining = timeoutMs - millisSince(start);
+                if (remaining <= 0)
+                    break;
+
+                struct pollfd pfd = {fd, POLLIN, 0};
+                int ready = poll(&pfd, 1, remaining);
+                if (ready < 0 && errno == EINTR)
+                    continue;
+                if (ready <= 0)
+                    break;
+
+                ssize_t count = ::read(fd, data + size, length - size);
+                if (count < 0 && errno == EINTR)
+                    continue;
+                if (count <= 0)
+                    break;
+                size += count;
+            }
+            return size;
+        }
+
+        void SerialPort::flushInputStream() {
+            tcflush(fd, TCIFLUSH);
+        }
+
+
+
+        /* AsyncDisplay::RequestQueue */
+
+        AsyncDisplay::RequestQueue::RequestQueue():head(&stub) {
+            stub.next.store(nullptr, std::memory_order_relaxed);
+            tail = &stub;
+        }
+
+        void AsyncDisplay::RequestQueue::push(Request *request) {
+            request->next.store(nullptr, std::memory_order_relaxed);
+            Request *previous = head.exchange(request, std::memory_order_acq_rel);
+            previous->next.store(request, std::memory_order_release);
+        }
+
+        AsyncDisplay::Request *AsyncDisplay::RequestQueue::pop() {
+            Request *first = tail;
+            Request *next = first->next.load(std::memory_order_acquire);
+            if (first == &stub) {
+                if (next == nullptr)
+                    return nullptr;
+                tail = next;
+                first = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+            if (next != nullptr) {
+                tail = next;
+                return first;
+            }
+
+            //a producer has swapped head but not linked its request yet, it will wake the writer once it has
+            if (first != head.load(std::memory_order_acquire))
+                return nullptr;
+
+            push(&stub);
+            next = first->next.load(std::memory_order_acquire);
+            if (next != nullptr) {
+                tail = next;
+                return first;
+            }
+            return nullptr;
+        }
+
+        bool AsyncDisplay::RequestQueue::empty() {
+            return tail == &stub && head.load(std::memory_order_acquire) == &stub;
+        }
+
+
+
+        /* AsyncDisplay */
+
+        AsyncDisplay::AsyncDisplay(const char *device, long baudRate):stopping(false) {
+            serial.open(device, baudRate);
+            wakeUpFd = eventfd(0, EFD_CLOEXEC);
+            if (wakeUpFd < 0)
+                throw std::system_error(errno, std::generic_category(), "eventfd");
+            writer = std::thread(&AsyncDisplay::run, this);
+        }
+
+        AsyncDisplay::~AsyncDisplay() {
+            stopping.store(true, std::memory_order_release);
+            uint64_t one = 1;
+            while (::write(wakeUpFd, &one, sizeof(one)) < 0 && errno == EINTR);
+            writer.join();
+            ::close(wakeUpFd);
+        }
+
+        bool AsyncDisplay::isOpen() {
+            return serial.isOpen();
+        }
+
+
+        /* System Control Functions */
+
+        std::future<bool> AsyncDisplay::handshake(Callback callback) {
+            return submit(Command::HANDSHAKE, nullptr, 0, callback);
+        }
+
+        std::future<bool> AsyncDisplay::setBaudRate(long baudRate, Callback callback) {
+            uint8_t args[4];
+            args[0] = (baudRate >> 24) & 0xFF;
+            args[1] = (baudRate >> 16) & 0xFF;
+            args[2] = (baudRate >> 8) & 0xFF;
+            args[3] = baudRate & 0xFF;
+            return submit(Command::SET_BAUD_RATE, args, 4, callback);
+        }
+
+        std::future<bool> AsyncDisplay::setStorageArea(StorageArea storageArea, Callback callback) {
+            uint8_t args[1] = {storageArea};
+            return submit(Command::SET_STORAGE_AREA, args, 1, callback);
+        }
+
+        std::future<bool> AsyncDisplay::enterSleep(Callback callback) {
+            return submit(Command::ENTER_SLEEP, nullptr, 0, callback);
+        }
+
+        std::future<bool> AsyncDisplay::refresh(Callback callback) {
+            return submit(Command::REFRESH, nullptr, 0, callback);
+        }
+
+        std::future<bool> AsyncDisplay::setDisplayDirection(DisplayDirection displayDirection, Callback callback) {
+            uint8_t args[1] = {displayDirection};
+            return submit(Command::SET_DISP_DIRECTION, args, 1, callback);
+        }
+
+
+        /* Display Parameter Configuration Functions */
+
+        std::future<bool> AsyncDisplay::setDrawingColor(Color color, Color backgroundColor, Callback callback) {
+            uint8_t args[2] = {color, backgroundColor};
+            return submit(Command::SET_DRAWING_COLOR, args, 2, callback);
+        }
+
+        std::future<bool> AsyncDisplay::setEnglishFontSize(FontSize fontSize, Callback callback) {
+            uint8_t args[1] = {fontSize};
+            return submit(Command::SET_ENGLISH_FONT_SIZE, args, 1, callback);
+        }
+
+        std::future<bool> AsyncDisplay::setChineseFontSize(FontSize fontSize, Callback callback) {
+            uint8_t args[1] = {fontSize};
+            return submit(Command::SET_CHINESE_FONT_SIZE, args, 1, callback);
+        }
+
+
+        /* Basic Drawing Functions */
+
+        std::future<bool> AsyncDisplay::drawPoint(unsigned int x, unsigned int y, Callback callback) {
+            unsigned int values[2] = {x, y};
+            return submitPoints(Command::DRAW_POINT, values, 2, callback);
+        }
+
+        std::future<bool> AsyncDisplay::drawLine(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                Callback callback) {
+            unsigned int values[4] = {x0, y0, x1, y1};
+            return submitPoints(Command::DRAW_LINE, values, 4, callback);
+        }
+
+        std::future<bool> AsyncDisplay::fillRectangle(unsigned int x0, unsigned int y0, unsigned int x1,
+                unsigned int y1, Callback callback) {
+            unsigned int values[4] = {x0, y0, x1, y1};
+            return submitPoints(Command::FILL_RECTANGLE, values, 4, callback);
+        }
+
+        std::future<bool> AsyncDisplay::drawRectangle(unsigned int x0, unsigned int y0, unsigned int x1,
+                unsigned int y1, Callback callback) {
+            unsigned int values[4] = {x0, y0, x1, y1};
+            return submitPoints(Command::DRAW_RECTANGLE, values, 4, callback);
+        }
+
+        std::future<bool> AsyncDisplay::drawCircle(unsigned int x, unsigned int y, unsigned int radius,
+                Callback callback) {
+            unsigned int values[3] = {x, y, radius};
+            return submitPoints(Command::DRAW_CIRCLE, values, 3, callback);
+        }
+
+        std::future<bool> AsyncDisplay::fillCircle(unsigned int x, unsigned int y, unsigned int radius,
+                Callback callback) {
+            unsigned int values[3] = {x, y, radius};
+            return submitPoints(Command::FILL_CIRCLE, values, 3, callback);
+        }
+
+        std::future<bool> AsyncDisplay::drawTriangle(unsigned int x0, unsigned int y0, unsigned int x1,
+                unsigned int y1, unsigned int x2, unsigned int y2, Callback callback) {
+            unsigned int values[6] = {x0, y0, x1, y1, x2, y2};
+            return submitPoints(Command::DRAW_TRIANGLE, values, 6, callback);
+        }
+
+        std::future<bool> AsyncDisplay::fillTriangle(unsigned int x0, unsigned int y0, unsigned int x1,
+                unsigned int y1, unsigned int x2, unsigned int y2, Callback callback) {
+            unsigned int values[6] = {x0, y0, x1, y1, x2, y2};
+            return submitPoints(Command::FILL_TRIANGLE, values, 6, callback);
+        }
+
+        std::future<bool> AsyncDisplay::clearScreen(Callback callback) {
+            return submit(Command::CLEAR_SCREEN, nullptr, 0, callback);
+        }
+
+        std::future<bool> AsyncDisplay::displayText(unsigned int x, unsigned int y, const std::string &str,
+                Callback callback) {
+            return submitString(Command::DISPLAY_TEXT, x, y, str, callback);
+        }
+
+        std::future<bool> AsyncDisplay::displayImage(unsigned int x, unsigned int y, const std::string &fileName,
+                Callback callback) {
+            return submitString(Command::DISPLAY_IMAGE, x, y, fileName, callback);
+        }
+
+
+        /* Private functions */
+
+        std::future<bool> AsyncDisplay::submit(Command command, const uint8_t *args, unsigned int argsLength,
+                Callback callback) {
+            Request *request = new Request();
+            request->command = command;
+            request->args.assign(args, args + argsLength);
+            request->callback = callback;
+            std::future<bool> result = request->promise.get_future();
+
+            //oversized arguments still go through the queue, so the callback runs on the writer thread and
+            //completes with false when encodeFrame() rejects them
+            queue.push(request);
+            uint64_t one = 1;
+            while (::write(wakeUpFd, &one, sizeof(one)) < 0 && errno == EINTR);
+            return result;
+        }
+
+        std::future<bool> AsyncDisplay::submitPoints(Command command, const unsigned int *values,
+                unsigned int count, Callback callback) {
+            uint8_t args[12];
+            for (unsigned int i = 0; i < count; ++i) {
+                args[i * 2] = (values[i] >> 8) & 0xFF;
+                args[i * 2 + 1] = values[i] & 0xFF;
+            }
+            return submit(command, args, count * 2, callback);
+        }
+
+        std::future<bool> AsyncDisplay::submitString(Command command, unsigned int x, unsigned int y,
+                const std::string &str, Callback callback) {
+            std::vector<uint8_t> args(4);
+            args[0] = (x >> 8) & 0xFF;
+            args[1] = x & 0xFF;
+            args[2] = (y >> 8) & 0xFF;
+            args[3] = y & 0xFF;
+            args.insert(args.end(), str.c_str(), str.c_str() + str.size() + 1); //include the null character
+            return submit(command, args.data(), args.size(), callback);
+        }
+
+        void AsyncDisplay::run() {
+            while (true) {
+                Request *request = queue.pop();
+                if (request != nullptr) {
+                    //once the destructor has started, whatever is still queued is dropped instead of sent
+                    bool send = !stopping.load(std::memory_order_acquire) && serial.isOpen();
+                    complete(request, send && execute(*request));
+                    continue;
+                }
+
+                if (stopping.load(std::memory_order_acquire))
+                    break;
+
+                uint64_t count;
+                while (::read(wakeUpFd, &count, sizeof(count)) < 0 && errno == EINTR);
+            }
+
+            //pop() returns nullptr while a producer is between swapping head and linking its request, so keep
+            //going until the queue is really empty
+            while (!queue.empty()) {
+                Request *request = queue.pop();
+                if (request == nullptr) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                complete(request, false);
+            }
+        }
+
+        bool AsyncDisplay::execute(Request &request) {
+            bool success = sendFrame(request.command, request.args.data(), request.args.size());
+
+            switch (request.command) {
+                case Command::SET_BAUD_RATE: {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(125));
+                    long baudRate = ((long)request.args[0] << 24) | ((long)request.args[1] << 16)
+                        | ((long)request.args[2] << 8) | request.args[3];
+                    success &= serial.setBaudRate(baudRate);
+                    return success && sendFrame(Command::HANDSHAKE, nullptr, 0) && checkOkResponse();
+                }
+                case Command::ENTER_SLEEP:
+                    return success;
+                case Command::CLEAR_SCREEN: {
+                    //NOTE: See Display::clearScreen, the command after CLEAR_SCREEN returns "OK" regardless
+                    success = success && checkOkResponse();
+                    return sendFrame(Command::HANDSHAKE, nullptr, 0) && checkOkResponse() && success;
+                }
+                default:
+                    return success && checkOkResponse();
+            }
+        }
+
+        bool AsyncDisplay::sendFrame(Command command, const uint8_t *args, unsigned int argsLength) {
+            unsigned int frameLength = Protocol::encodeFrame(outputBuffer, command, args, argsLength);
+            serial.flushInputStream();
+            return frameLength > 0 && serial.write(outputBuffer, frameLength);
+        }
+
+        bool AsyncDisplay::checkOkResponse() {
+            uint8_t inBuffer[2];
+            return serial.read(inBuffer, 2, WAIT_FOR_RESPONSE_MS) == 2 && inBuffer[0] == 'O' && inBuffer[1] == 'K';
+        }
+
+        void AsyncDisplay::complete(Request *request, bool success) {
+            request->promise.set_value(success);
+            if (request->callback)
+                request->callback(success);
+            delete request;
+        }
+
+    };
+};
@@ -0,0 +1,151 @@
+/**
+ *  Linux host front end for the panel, for gateways where several threads want to draw at once.
+ *
+ *  Any thread may call the drawing functions on AsyncDisplay. Each call only allocates a request and pushes it
+ *  onto a lock-free multi-producer single-consumer queue, so callers never wait on the serial port. A single
+ *  writer thread owns the port: it pops requests in submission order, encodes the frame, sends it and waits for
+ *  the panel's "OK" before completing the returned future and the optional callback with the result.
+ *
+ *  Callbacks run on the writer thread and should return quickly; submitting more commands from a callback is
+ *  fine. Commands still queued when the AsyncDisplay is destroyed are not sent and complete with false, while
+ *  the one being sent at that moment finishes normally. The constructor throws std::system_error if the
+ *  writer's wake up eventfd can't be created; a device that can't be opened is reported by isOpen() instead
+ *  and every command completes with false.
+ *
+ *  This code is not part of the Arduino library build. Build it together with the protocol sources, e.g.
+ *      g++ -std=c++11 -pthread -I../.. ../../epd_protocol.cpp epd_host.cpp your_app.cpp
+ */
+#ifndef EPD_HOST_h
+#define EPD_HOST_h
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "epd_protocol.h"
+
+namespace EPD {
+    namespace Host {
+
+        class SerialPort {
+
+            public:
+                SerialPort();
+                ~SerialPort();
+
+                bool open(const char *device, long baudRate);
+                void close();
+                bool isOpen();
+                bool setBaudRate(long baudRate);
+                bool write(const uint8_t *data, unsigned int length);
+                unsigned int read(uint8_t *data, unsigned int length, int timeoutMs);
+                void flushInputStream();
+
+
+            private:
+                int fd;
+        };
+
+        class AsyncDisplay {
+
+            public:
+                typedef std::function<void(bool)> Callback;
+
+                AsyncDisplay(const char *device, long baudRate = 115200);
+                ~AsyncDisplay();
+
+                bool isOpen();
+
+                /* System Control Functions */
+                std::future<bool> handshake(Callback callback = Callback());
+                std::future<bool> setBaudRate(long baudRate, Callback callback = Callback());
+                std::future<bool> setStorageArea(StorageArea storageArea, Callback callback = Callback());
+                std::future<bool> enterSleep(Callback callback = Callback());
+                std::future<bool> refresh(Callback callback = Callback());
+                std::future<bool> setDisplayDirection(DisplayDirection displayDirection, Callback callback = Callback());
+
+                /* Display Parameter Configuration Functions */
+                std::future<bool> setDrawingColor(Color color, Color backgroundColor, Callback callback = Callback());
+                std::future<bool> setEnglishFontSize(FontSize fontSize, Callback callback = Callback());
+                std::future<bool> setChineseFontSize(FontSize fontSize, Callback callback = Callback());
+
+                /* Basic Drawing Functions */
+                std::future<bool> drawPoint(unsigned int x, unsigned int y, Callback callback = Callback());
+                std::future<bool> drawLine(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                    Callback callback = Callback());
+                std::future<bool> fillRectangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                    Callback callback = Callback());
+                std::future<bool> drawRectangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                    Callback callback = Callback());
+                std::future<bool> drawCircle(unsigned int x, unsigned int y, unsigned int radius,
+                    Callback callback = Callback());
+                std::future<bool> fillCircle(unsigned int x, unsigned int y, unsigned int radius,
+                    Callback callback = Callback());
+                std::future<bool> drawTriangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                    unsigned int x2, unsigned int y2, Callback callback = Callback());
+                std::future<bool> fillTriangle(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1,
+                    unsigned int x2, unsigned int y2, Callback callback = Callback());
+                std::future<bool> clearScreen(Callback callback = Callback());
+
+                std::future<bool> displayText(unsigned int x, unsigned int y, const std::string &str,
+                    Callback callback = Callback());
+
+                std::future<bool> displayImage(unsigned int x, unsigned int y, const std::string &fileName,
+                    Callback callback = Callback());
+
+
+            private:
+                static const int WAIT_FOR_RESPONSE_MS = 100;
+
+                struct Request {
+                    std::atomic<Request *> next;
+                    Command command;
+                    std::vector<uint8_t> args;
+                    std::promise<bool> promise;
+                    Callback callback;
+                };
+
+                /* Intrusive MPSC queue (Vyukov). push() is wait-free for producers, pop() is only ever called by
+                   the writer thread. */
+                class RequestQueue {
+
+                    public:
+                        RequestQueue();
+                        void push(Request *request);
+                        Request *pop();
+                        bool empty();
+
+
+                    private:
+                        std::atomic<Request *> head;
+                        Request *tail;
+                        Request stub;
+                };
+
+                SerialPort serial;
+                RequestQueue queue;
+                std::atomic<bool> stopping;
+                int wakeUpFd;
+                std::thread writer;
+                uint8_t outputBuffer[Protocol::MAX_FRAME_LENGTH];
+
+                std::future<bool> submit(Command command, const uint8_t *args, unsigned int argsLength,
+                    Callback callback);
+                std::future<bool> submitPoints(Command command, const unsigned int *values, unsigned int count,
+                    Callback callback);
+                std::future<bool> submitString(Command command, unsigned int x, unsigned int y,
+                    const std::string &str, Callback callback);
+                void run();
+                bool execute(Request &request);
+                bool sendFrame(Command command, const uint8_t *args, unsigned int argsLength);
+                bool checkOkResponse();
+                void complete(Request *request, bool success);
+        };
+
+    };
+};
+
+#endif
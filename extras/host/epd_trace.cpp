@@ -0,0 +1,361 @@
+/**
+ *  Decodes, summarizes and replays wire traces written by Display::setTraceOutput().
+ *
+ *      epd_trace decode <trace>
+ *          Prints every record with the command names and arguments of the frames that were sent, and flags
+ *          frames with a bad header, frame end, parity byte or a length field that doesn't match what was sent.
+ *      epd_trace summary <trace>
+ *          Prints the count, bytes and time spent per command. The time of a command runs from its frame to the
+ *          next frame, so it includes waiting for the response.
+ *      epd_trace replay <trace> <device> <baudRate> <outputTrace>
+ *          Sends every frame in the trace to the device, paced as if the link ran at the given baud rate, and
+ *          writes what was sent and received to a new trace so the two can be compared with summary. Baud rate
+ *          changes recorded in the trace override <baudRate> from the point they are reached, unless the device
+ *          rejects the recorded rate.
+ *
+ *  Build with:
+ *      g++ -std=c++11 -pthread -I../.. ../../epd_protocol.cpp epd_host.cpp epd_trace.cpp -o epd_trace
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "epd_host.h"
+#include "epd_protocol.h"
+
+using namespace EPD;
+
+/* Display waits 20 ms before reading and the serial timeout is 100 ms */
+static const int RESPONSE_TIMEOUT_MS = 120;
+
+struct Record {
+    uint8_t kind;
+    uint32_t timestamp;
+    std::vector<uint8_t> payload;
+};
+
+struct CommandStats {
+    unsigned long count;
+    unsigned long bytes;
+    unsigned long long micros;
+};
+
+static const char *commandName(uint8_t command) {
+    switch (command) {
+        case Command::HANDSHAKE:                return "HANDSHAKE";
+        case Command::SET_BAUD_RATE:            return "SET_BAUD_RATE";
+        case Command::GET_BAUD_RATE:            return "GET_BAUD_RATE";
+        case Command::GET_STORAGE_AREA:         return "GET_STORAGE_AREA";
+        case Command::SET_STORAGE_AREA:         return "SET_STORAGE_AREA";
+        case Command::ENTER_SLEEP:              return "ENTER_SLEEP";
+        case Command::REFRESH:                  return "REFRESH";
+        case Command::GET_DISP_DIRECTION:       return "GET_DISP_DIRECTION";
+        case Command::SET_DISP_DIRECTION:       return "SET_DISP_DIRECTION";
+        case Command::IMPORT_FONT_LIBRARY:      return "IMPORT_FONT_LIBRARY";
+        case Command::IMPORT_IMAGE:             return "IMPORT_IMAGE";
+        case Command::SET_DRAWING_COLOR:        return "SET_DRAWING_COLOR";
+        case Command::GET_DRAWING_COLOR:        return "GET_DRAWING_COLOR";
+        case Command::GET_ENGLISH_FONT_SIZE:    return "GET_ENGLISH_FONT_SIZE";
+        case Command::GET_CHINESE_FONT_SIZE:    return "GET_CHINESE_FONT_SIZE";
+        case Command::SET_ENGLISH_FONT_SIZE:    return "SET_ENGLISH_FONT_SIZE";
+        case Command::SET_CHINESE_FONT_SIZE:    return "SET_CHINESE_FONT_SIZE";
+        case Command::DRAW_POINT:               return "DRAW_POINT";
+        case Command::DRAW_LINE:                return "DRAW_LINE";
+        case Command::FILL_RECTANGLE:           return "FILL_RECTANGLE";
+        case Command::DRAW_RECTANGLE:           return "DRAW_RECTANGLE";
+        case Command::DRAW_CIRCLE:              return "DRAW_CIRCLE";
+        case Command::FILL_CIRCLE:              return "FILL_CIRCLE";
+        case Command::DRAW_TRIANGLE:            return "DRAW_TRIANGLE";
+        case Command::FILL_TRIANGLE:            return "FILL_TRIANGLE";
+        case Command::CLEAR_SCREEN:             return "CLEAR_SCREEN";
+        case Command::DISPLAY_TEXT:             return "DISPLAY_TEXT";
+        case Command::DISPLAY_IMAGE:            return "DISPLAY_IMAGE";
+        default:                                return "UNKNOWN";
+    }
+}
+
+/* Returns the name of the command in a sent frame, or UNKNOWN if the frame is too short to hold one */
+static const char *frameCommandName(const std::vector<uint8_t> &frame) {
+    if (frame.size() < Protocol::PREFIX_LENGTH)
+        return commandName(0xFF);
+    return commandName(frame[3]);
+}
+
+static uint32_t readBigEndian(const uint8_t *data, unsigned int length) {
+    uint32_t value = 0;
+    for (unsigned int i = 0; i < length; ++i) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+static bool readTrace(const char *fileName, std::vector<Record> &records) {
+    FILE *file = fopen(fileName, "rb");
+    if (!file) {
+        perror(fileName);
+        return false;
+    }
+
+    uint8_t header[Trace::RECORD_HEADER_LENGTH];
+    while (fread(header, 1, Trace::RECORD_HEADER_LENGTH, file) == Trace::RECORD_HEADER_LENGTH) {
+        Record record;
+        record.kind = header[0];
+        record.timestamp = readBigEndian(header + 1, 4);
+        record.payload.resize(readBigEndian(header + 5, 2));
+        if (fread(record.payload.data(), 1, record.payload.size(), file) != record.payload.size()) {
+            fprintf(stderr, "%s: truncated record at the end of the trace\n", fileName);
+            break;
+        }
+        records.push_back(record);
+    }
+    fclose(file);
+    return true;
+}
+
+static void writeRecord(FILE *file, uint8_t kind, uint32_t timestamp, const uint8_t *data, unsigned int length) {
+    uint8_t header[Trace::RECORD_HEADER_LENGTH] = {kind,
+        (uint8_t)(timestamp >> 24), (uint8_t)(timestamp >> 16), (uint8_t)(timestamp >> 8), (uint8_t)timestamp,
+        (uint8_t)(length >> 8), (uint8_t)length};
+    fwrite(header, 1, Trace::RECORD_HEADER_LENGTH, file);
+    fwrite(data, 1, length, file);
+}
+
+/* Returns the problems with a sent frame, or an empty string if it's well formed */
+static std::string checkFrame(const std::vector<uint8_t> &frame) {
+    char message[128];
+    if (frame.size() < Protocol::PREFIX_LENGTH + Protocol::SUFFIX_LENGTH)
+        return "frame too short";
+    if (frame[0] != Protocol::FRAME_HEADER)
+        return "bad frame header";
+
+    std::string problems;
+    unsigned int length = readBigEndian(frame.data() + 1, 2);
+    if (length != frame.size()) {
+        snprintf(message, sizeof(message), "length field is %u but %u bytes were sent; ", length,
+            (unsigned int)frame.size());
+        problems += message;
+    }
+    if (length > frame.size() || length < Protocol::PREFIX_LENGTH + Protocol::SUFFIX_LENGTH)
+        return problems + "frame end and parity not checked";
+
+    if (memcmp(frame.data() + length - Protocol::SUFFIX_LENGTH, Protocol::FRAME_END, 4) != 0)
+        problems += "bad frame end; ";
+    uint8_t parityByte = Protocol::calculateParityByte(frame.data(), length - 1);
+    if (parityByte != frame[length - 1]) {
+        snprintf(message, sizeof(message), "parity byte is 0x%02X, expected 0x%02X; ", frame[length - 1],
+            parityByte);
+        problems += message;
+    }
+    if (!problems.empty())
+        problems.resize(problems.size() - 2);
+    return problems;
+}
+
+static std::string formatArguments(const std::vector<uint8_t> &frame) {
+    std::string out;
+    char value[16];
+    //checkFrame() reports frames that are too short, there are no arguments to show for them
+    if (frame.size() < Protocol::PREFIX_LENGTH + Protocol::SUFFIX_LENGTH)
+        return out;
+    unsigned int length = std::min((unsigned int)readBigEndian(frame.data() + 1, 2), (unsigned int)frame.size());
+    if (length < Protocol::PREFIX_LENGTH + Protocol::SUFFIX_LENGTH)
+        return out;
+    const uint8_t *args = frame.data() + Protocol::PREFIX_LENGTH;
+    unsigned int argsLength = length - Protocol::PREFIX_LENGTH - Protocol::SUFFIX_LENGTH;
+
+    switch (frame[3]) {
+        case Command::SET_BAUD_RATE:
+            if (argsLength == 4) {
+                snprintf(value, sizeof(value), "%u", readBigEndian(args, 4));
+                out = value;
+            }
+            return out;
+        case Command::DRAW_POINT: case Command::DRAW_LINE: case Command::FILL_RECTANGLE:
+        case Command::DRAW_RECTANGLE: case Command::DRAW_CIRCLE: case Command::FILL_CIRCLE:
+        case Command::DRAW_TRIANGLE: case Command::FILL_TRIANGLE:
+            for (unsigned int i = 0; i + 1 < argsLength; i += 2) {
+                snprintf(value, sizeof(value), "%s%u", i ? ", " : "", readBigEndian(args + i, 2));
+                out += value;
+            }
+            return out;
+        case Command::DISPLAY_TEXT: case Command::DISPLAY_IMAGE:
+            if (argsLength < 4)
+                return out;
+            snprintf(value, sizeof(value), "%u, %u, \"", readBigEndian(args, 2), readBigEndian(args + 2, 2));
+            out = value;
+            for (unsigned int i = 4; i < argsLength && args[i] != 0x00; ++i) {
+                if (args[i] >= 0x20 && args[i] < 0x7F && args[i] != '"' && args[i] != '\\') {
+                    out += (char)args[i];
+                } else {
+                    snprintf(value, sizeof(value), "\\x%02X", args[i]);
+                    out += value;
+                }
+            }
+            return out + "\"";
+        default:
+            for (unsigned int i = 0; i < argsLength; ++i) {
+                snprintf(value, sizeof(value), "%s%u", i ? ", " : "", args[i]);
+                out += value;
+            }
+            return out;
+    }
+}
+
+static std::string formatResponse(const std::vector<uint8_t> &payload) {
+    std::string out = "\"";
+    char value[8];
+    for (unsigned int i = 0; i < payload.size(); ++i) {
+        if (payload[i] >= 0x20 && payload[i] < 0x7F && payload[i] != '"' && payload[i] != '\\') {
+            out += (char)payload[i];
+        } else {
+            snprintf(value, sizeof(value), "\\x%02X", payload[i]);
+            out += value;
+        }
+    }
+    return out + "\"";
+}
+
+static int decode(const std::vector<Record> &records) {
+    unsigned long errorCount = 0;
+    uint32_t start = records.empty() ? 0 : records[0].timestamp;
+
+    for (unsigned int i = 0; i < records.size(); ++i) {
+        const Record &record = records[i];
+        double ms = (uint32_t)(record.timestamp - start) / 1000.0;
+
+        if (record.kind == Trace::TX) {
+            printf("%12.3f ms  TX %-22s (%s)\n", ms, frameCommandName(record.payload),
+                formatArguments(record.payload).c_str());
+            std::string problems = checkFrame(record.payload);
+            if (!problems.empty()) {
+                printf("%18s !! %s\n", "", problems.c_str());
+                ++errorCount;
+            }
+        } else if (record.kind == Trace::RX) {
+            printf("%12.3f ms  RX %s\n", ms, formatResponse(record.payload).c_str());
+        } else if (record.kind == Trace::BAUD_RATE && record.payload.size() == 4) {
+            printf("%12.3f ms  -- baud rate now %u\n", ms, readBigEndian(record.payload.data(), 4));
+        } else {
+            printf("%12.3f ms  ?? unknown record kind 0x%02X\n", ms, record.kind);
+            ++errorCount;
+        }
+    }
+
+    printf("\n%lu malformed frame(s)\n", errorCount);
+    return errorCount ? 1 : 0;
+}
+
+static int summary(const std::vector<Record> &records) {
+    std::map<std::string, CommandStats> stats;
+    unsigned long long totalMicros = 0;
+    const Record *previous = NULL;
+
+    for (unsigned int i = 0; i < records.size(); ++i) {
+        if (records[i].kind != Trace::TX)
+            continue;
+        if (previous) {
+            CommandStats &entry = stats[frameCommandName(previous->payload)];
+            entry.micros += (uint32_t)(records[i].timestamp - previous->timestamp);
+        }
+        CommandStats &entry = stats[frameCommandName(records[i].payload)];
+        ++entry.count;
+        entry.bytes += records[i].payload.size();
+        previous = &records[i];
+    }
+    //the last command runs until the last record in the trace
+    if (previous) {
+        CommandStats &entry = stats[frameCommandName(previous->payload)];
+        entry.micros += (uint32_t)(records.back().timestamp - previous->timestamp);
+    }
+
+    printf("%-22s %8s %10s %12s %10s\n", "command", "count", "bytes", "total ms", "mean ms");
+    for (std::map<std::string, CommandStats>::iterator it = stats.begin(); it != stats.end(); ++it) {
+        printf("%-22s %8lu %10lu %12.3f %10.3f\n", it->first.c_str(), it->second.count, it->second.bytes,
+            it->second.micros / 1000.0, it->second.micros / 1000.0 / it->second.count);
+        totalMicros += it->second.micros;
+    }
+    printf("%-22s %8s %10s %12.3f\n", "total", "", "", totalMicros / 1000.0);
+    return 0;
+}
+
+static int replay(const std::vector<Record> &records, const char *device, long baudRate, const char *outputName) {
+    Host::SerialPort serial;
+    if (!serial.open(device, baudRate)) {
+        fprintf(stderr, "%s: could not open at %ld baud\n", device, baudRate);
+        return 1;
+    }
+    FILE *output = fopen(outputName, "wb");
+    if (!output) {
+        perror(outputName);
+        return 1;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint8_t inBuffer[256];
+
+    for (unsigned int i = 0; i < records.size(); ++i) {
+        if (records[i].kind == Trace::BAUD_RATE && records[i].payload.size() == 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(125));
+            //only adopt the recorded rate if the device accepts it, a corrupt rate keeps the current one
+            long recordedBaudRate = readBigEndian(records[i].payload.data(), 4);
+            if (serial.setBaudRate(recordedBaudRate)) {
+                baudRate = recordedBaudRate;
+                uint32_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                writeRecord(output, Trace::BAUD_RATE, timestamp, records[i].payload.data(), 4);
+            } else {
+                fprintf(stderr, "%s: could not switch to %ld baud, staying at %ld\n", device, recordedBaudRate,
+                    baudRate);
+            }
+        }
+        if (records[i].kind != Trace::TX)
+            continue;
+        const std::vector<uint8_t> &frame = records[i].payload;
+
+        //expect as many response bytes as the original trace received for this frame
+        unsigned int expected = 0;
+        if (i + 1 < records.size() && records[i + 1].kind == Trace::RX)
+            expected = std::min((unsigned int)records[i + 1].payload.size(), (unsigned int)sizeof(inBuffer));
+
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        uint32_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(sent - start).count();
+        writeRecord(output, Trace::TX, timestamp, frame.data(), frame.size());
+        serial.flushInputStream();
+        serial.write(frame.data(), frame.size());
+        //one start bit, eight data bits and one stop bit per byte
+        std::this_thread::sleep_until(sent + std::chrono::microseconds(frame.size() * 10 * 1000000LL / baudRate));
+
+        if (expected > 0) {
+            unsigned int size = serial.read(inBuffer, expected, RESPONSE_TIMEOUT_MS);
+            timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            writeRecord(output, Trace::RX, timestamp, inBuffer, size);
+        }
+    }
+
+    fclose(output);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    std::vector<Record> records;
+
+    if (argc == 3 && strcmp(argv[1], "decode") == 0 && readTrace(argv[2], records))
+        return decode(records);
+    if (argc == 3 && strcmp(argv[1], "summary") == 0 && readTrace(argv[2], records))
+        return summary(records);
+    if (argc == 6 && strcmp(argv[1], "replay") == 0 && readTrace(argv[2], records))
+        return replay(records, argv[3], atol(argv[4]), argv[5]);
+
+    fprintf(stderr, "usage: %s decode <trace>\n", argv[0]);
+    fprintf(stderr, "       %s summary <trace>\n", argv[0]);
+    fprintf(stderr, "       %s replay <trace> <device> <baudRate> <outputTrace>\n", argv[0]);
+    fprintf(stderr, "       (baud rate changes recorded in the trace override <baudRate> once reached)\n");
+    return 2;
+}
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Generates epd_gbk_table.h, the flash resident Unicode to GBK lookup table used by epd_gbk.cpp.
+
+The table only covers characters that the panel's GB2312 fonts can draw. By default that is the GB2312 symbol
+rows (0xA1-0xA9) and the level 1 hanzi (0xB0-0xD7). Pass --level2 to include the level 2 hanzi as well, or
+--chars to only include the characters found in the given UTF-8 files, which keeps the table small enough for
+boards like the ATmega32U4 when the set of strings is known ahead of time.
+
+Layout (all arrays are in PROGMEM):
+    GBK_PAGE_INDEX[256]         slot of each 256 code point page, or 0xFF if the page has no characters
+    GBK_BLOCK_BITMAPS[n][8]     one bit per code point for each 64 code point block of every used page
+    GBK_BLOCK_BASES[n]          index into GBK_CODES of the first character in each block
+    GBK_CODES[m]                GBK codes of every supported character, in code point order
+"""
+
+import argparse
+import sys
+
+
+def gb2312_code_points(level2):
+    last_row = 0xF7 if level2 else 0xD7
+    rows = list(range(0xA1, 0xAA)) + list(range(0xB0, last_row + 1))
+    code_points = {}
+    for row in rows:
+        for cell in range(0xA1, 0xFF):
+            try:
+                char = bytes([row, cell]).decode('gb2312')
+            except UnicodeDecodeError:
+                continue
+            code_points[ord(char)] = (row << 8) | cell
+    return code_points
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--level2', action='store_true', help='include the GB2312 level 2 hanzi')
+    parser.add_argument('--chars', nargs='+', metavar='FILE', help='only include characters used in these files')
+    parser.add_argument('-o', '--output', default='epd_gbk_table.h')
+    args = parser.parse_args()
+
+    code_points = gb2312_code_points(args.level2 or args.chars is not None)
+    if args.chars:
+        used = set()
+        for name in args.chars:
+            with open(name, encoding='utf-8') as f:
+                used.update(ord(c) for c in f.read())
+        code_points = {cp: code for cp, code in code_points.items() if cp in used}
+
+    pages = sorted({cp >> 8 for cp in code_points})
+    if len(pages) >= 0xFF:
+        sys.exit('too many pages for an 8 bit page index')
+
+    page_index = [0xFF] * 256
+    bitmaps = []
+    bases = []
+    codes = []
+    for slot, page in enumerate(pages):
+        page_index[page] = slot
+        for block in range(4):
+            start = (page << 8) | (block << 6)
+            bitmap = [0] * 8
+            bases.append(len(codes))
+            for offset in range(64):
+                if start + offset in code_points:
+                    bitmap[offset >> 3] |= 1 << (offset & 7)
+                    codes.append(code_points[start + offset])
+            bitmaps.append(bitmap)
+
+    size = len(page_index) + len(bitmaps) * 8 + len(bases) * 2 + len(codes) * 2
+    with open(args.output, 'w', newline='\n') as out:
+        out.write('/**\n')
+        out.write(' *  Generated by extras/tools/generate_gbk_table.py, do not edit.\n')
+        out.write(' *  %d characters, %d pages, %d bytes of flash.\n' % (len(codes), len(pages), size))
+        out.write(' */\n')
+        out.write('#ifndef EPD_GBK_TABLE_h\n#define EPD_GBK_TABLE_h\n\n')
+        out.write('namespace EPD {\n    namespace Gbk {\n\n')
+        out.write('        const unsigned int BLOCK_COUNT = %d;\n' % len(bases))
+        out.write('        const unsigned int CODE_COUNT = %d;\n\n' % len(codes))
+
+        out.write('        const uint8_t GBK_PAGE_INDEX[256] PROGMEM = {\n')
+        for i in range(0, 256, 16):
+            out.write('            ' + ', '.join('0x%02X' % v for v in page_index[i:i + 16]) + ',\n')
+        out.write('        };\n\n')
+
+        out.write('        const uint8_t GBK_BLOCK_BITMAPS[BLOCK_COUNT][8] PROGMEM = {\n')
+        for bitmap in bitmaps:
+            out.write('            {' + ', '.join('0x%02X' % v for v in bitmap) + '},\n')
+        out.write('        };\n\n')
+
+        out.write('        const uint16_t GBK_BLOCK_BASES[BLOCK_COUNT] PROGMEM = {\n')
+        for i in range(0, len(bases), 12):
+            out.write('            ' + ', '.join('%d' % v for v in bases[i:i + 12]) + ',\n')
+        out.write('        };\n\n')
+
+        out.write('        const uint16_t GBK_CODES[CODE_COUNT] PROGMEM = {\n')
+        for i in range(0, len(codes), 12):
+            out.write('            ' + ', '.join('0x%04X' % v for v in codes[i:i + 12]) + ',\n')
+        out.write('        };\n\n')
+
+        out.write('    };\n};\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()